@@ -1,14 +1,31 @@
 #pragma once
 
+#include "DecodedImage.h"
+#include "SpriteCache.h"
+#include "TextureAtlas.h"
+
 #include <NAS2D/Resource/Font.h>
 #include <NAS2D/Resource/Image.h>
 #include <NAS2D/Resource/Music.h>
 #include <NAS2D/Resource/ResourceCache.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 
 inline NAS2D::ResourceCache<NAS2D::Font, std::string, unsigned int> fontCache;
 inline NAS2D::ResourceCache<NAS2D::Image, std::string> imageCache;
+inline TextureAtlas uiAtlas; /**< UI icon sheets, packed at startup. */
+inline SpriteCache spriteCache; /**< Sprite files used by structures and robots. */
+inline DecodedImageCache decodedImageCache; /**< Image files decoded on worker threads ahead of their textures being made. */
+
+// Sheets the HUD, panels and icon grids draw from, usually in the same frame.
+inline const std::vector<std::string> UiAtlasImages{
+	"ui/icons.png",
+	"ui/structures.png",
+	"ui/robots.png",
+	"ui/factory.png",
+};
 
 inline std::unique_ptr<NAS2D::Music> trackMars;
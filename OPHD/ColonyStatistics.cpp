@@ -0,0 +1,69 @@
+#include "ColonyStatistics.h"
+
+#include "Constants/Numbers.h"
+#include "StructureManager.h"
+
+#include <NAS2D/Utility.h>
+
+
+namespace
+{
+	/**
+	 * Storage from structures of a class that can hold resources, plus
+	 * the command center's base storage once it has been placed.
+	 */
+	int storageCapacity(StructureManager& structureManager, Structure::StructureClass structureClass)
+	{
+		int capacity = structureManager.structureList(Structure::StructureClass::Command).empty() ? 0 : constants::BaseStorageCapacity;
+
+		for (auto structure : structureManager.structureList(structureClass))
+		{
+			if (structure->operational() || structure->isIdle())
+			{
+				capacity += constants::StructureStorageCapacity;
+			}
+		}
+
+		return capacity;
+	}
+}
+
+
+const ColonyStatistics::Totals& ColonyStatistics::totals()
+{
+	const auto changeCount = NAS2D::Utility<StructureManager>::get().changeCount();
+	if (!mValid || changeCount != mStructureChangeCount)
+	{
+		recompute();
+		mStructureChangeCount = changeCount;
+		mValid = true;
+	}
+
+	return mTotals;
+}
+
+
+void ColonyStatistics::recompute()
+{
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
+
+	Totals totals;
+	totals.storageCapacity = storageCapacity(structureManager, Structure::StructureClass::Storage);
+	totals.foodStorageCapacity = storageCapacity(structureManager, Structure::StructureClass::FoodProduction);
+
+	const auto warehouses = structureManager.getStructures<Warehouse>();
+	totals.warehouseCount = warehouses.size();
+	for (auto warehouse : warehouses)
+	{
+		totals.trucksAvailable += warehouse->products().count(ProductType::PRODUCT_TRUCK);
+
+		if (warehouse->operational())
+		{
+			const auto& products = warehouse->products();
+			totals.warehouseCapacity += products.capacity();
+			totals.warehouseCapacityUsed += products.capacity() - products.availableStorage();
+		}
+	}
+
+	mTotals = totals;
+}
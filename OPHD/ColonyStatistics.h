@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+
+/**
+ * Colony wide totals derived from the structure lists.
+ *
+ * Totals are only recomputed after the StructureManager reports a
+ * change, so the HUD and reports can read them every frame without
+ * scanning structures every frame.
+ */
+class ColonyStatistics
+{
+public:
+	struct Totals
+	{
+		int storageCapacity = 0; /**< Refined resource capacity of the command center and storage tanks. */
+		int foodStorageCapacity = 0; /**< Food capacity of the command center and food producers. */
+
+		std::size_t warehouseCount = 0;
+		int warehouseCapacity = 0; /**< Product capacity of operational warehouses. */
+		int warehouseCapacityUsed = 0;
+		int trucksAvailable = 0; /**< Trucks stored in all warehouses. */
+	};
+
+	const Totals& totals();
+
+private:
+	void recompute();
+
+	Totals mTotals;
+	unsigned int mStructureChangeCount = 0;
+	bool mValid = false;
+};
@@ -1,4 +1,5 @@
 #include "Common.h"
+#include "ColonyStatistics.h"
 #include "Constants.h"
 #include "StructureManager.h"
 #include "XmlSerializer.h"
@@ -471,15 +472,7 @@ void drawBasicProgressBar(int x, int y, int width, int height, float percent, in
 
 int getTruckAvailability()
 {
-	int trucksAvailable = 0;
-
-	auto& warehouseList = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouseList)
-	{
-		trucksAvailable += warehouse->products().count(ProductType::PRODUCT_TRUCK);
-	}
-
-	return trucksAvailable;
+	return NAS2D::Utility<ColonyStatistics>::get().totals().trucksAvailable;
 }
 
 
@@ -494,6 +487,7 @@ int pullTruckFromInventory()
 	{
 		if (warehouse->products().pull(ProductType::PRODUCT_TRUCK, 1) > 0)
 		{
+			NAS2D::Utility<StructureManager>::get().markChanged();
 			return 1;
 		}
 	}
@@ -506,14 +500,12 @@ int pushTruckIntoInventory()
 {
 	const int storageNeededForTruck = storageRequiredPerUnit(ProductType::PRODUCT_TRUCK);
 
-	auto& warehouseList = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouseList)
+	auto warehouse = NAS2D::Utility<StructureManager>::get().warehouseIndex().findStorage(storageNeededForTruck);
+	if (warehouse)
 	{
-		if (warehouse->products().availableStorage() >= storageNeededForTruck)
-		{
-			warehouse->products().store(ProductType::PRODUCT_TRUCK, 1);
-			return 1;
-		}
+		warehouse->products().store(ProductType::PRODUCT_TRUCK, 1);
+		NAS2D::Utility<StructureManager>::get().markChanged();
+		return 1;
 	}
 
 	return 0;
@@ -15,6 +15,7 @@ namespace constants
 	inline constexpr int SmeltingMinimumResourcesCount{ 20 };
 
 	inline constexpr int BaseStorageCapacity{ 250 };
+	inline constexpr int StructureStorageCapacity{ 1000 };
 
 	inline constexpr int BaseProductCapacity{ 100 };
 
@@ -41,6 +41,8 @@ namespace constants
 	const std::string SaveGamePath = "savegames/";
 	const std::string SaveGameVersion = "0.31";
 	const std::string SaveGameRootNode = "OutpostHD_SaveGame";
+	const std::string SaveGameInfoRootNode = "OutpostHD_SaveGameInfo";
+	const std::string SaveGameInfoExtension = ".info";
 
 
 	// =====================================
@@ -0,0 +1,107 @@
+#include "DecodedImage.h"
+
+#include <NAS2D/Utility.h>
+#include <NAS2D/Filesystem.h>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include <cstring>
+#include <stdexcept>
+
+
+/**
+ * Reads and decodes an image file.
+ *
+ * \note	Safe to call from a worker thread. It doesn't touch the renderer.
+ *
+ * \throws	std::runtime_error if the file can't be decoded.
+ */
+DecodedImage::DecodedImage(const std::string& filename)
+{
+	const auto data = NAS2D::Utility<NAS2D::Filesystem>::get().read(filename);
+
+	auto* surface = IMG_Load_RW(SDL_RWFromConstMem(data.c_str(), static_cast<int>(data.size())), 1);
+	if (!surface)
+	{
+		throw std::runtime_error("DecodedImage::DecodedImage(): Unable to decode '" + filename + "': " + IMG_GetError());
+	}
+
+	auto* rgba = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+	SDL_FreeSurface(surface);
+	if (!rgba)
+	{
+		throw std::runtime_error("DecodedImage::DecodedImage(): Unable to convert '" + filename + "': " + SDL_GetError());
+	}
+
+	mSize = {rgba->w, rgba->h};
+	const auto rowLength = static_cast<std::size_t>(rgba->w) * 4;
+	mPixels.resize(rowLength * static_cast<std::size_t>(rgba->h));
+	for (int row = 0; row < rgba->h; ++row)
+	{
+		std::memcpy(mPixels.data() + static_cast<std::size_t>(row) * rowLength, static_cast<const std::uint8_t*>(rgba->pixels) + row * rgba->pitch, rowLength);
+	}
+
+	SDL_FreeSurface(rgba);
+}
+
+
+NAS2D::Color DecodedImage::pixelColor(NAS2D::Point<int> point) const
+{
+	const auto offset = static_cast<std::size_t>(point.y * mSize.x + point.x) * 4;
+	return {mPixels[offset], mPixels[offset + 1], mPixels[offset + 2], mPixels[offset + 3]};
+}
+
+
+/**
+ * Makes a texture from the decoded pixels.
+ *
+ * \note	Must be called from the thread that owns the renderer.
+ */
+std::unique_ptr<NAS2D::Image> DecodedImage::upload() const
+{
+	// NAS2D only reads from the buffer
+	return std::make_unique<NAS2D::Image>(const_cast<std::uint8_t*>(mPixels.data()), 4, mSize);
+}
+
+
+/**
+ * Starts decoding each file that isn't already decoded or being decoded.
+ */
+void DecodedImageCache::preload(const std::vector<std::string>& filenames)
+{
+	for (const auto& filename : filenames)
+	{
+		if (mImages.count(filename) > 0) { continue; }
+		mImages[filename] = std::async(std::launch::async, [filename]() { return DecodedImage{filename}; }).share();
+	}
+}
+
+
+/**
+ * Gets a decoded image, waiting on its worker if it's still being
+ * decoded. Files that weren't preloaded are decoded on the spot.
+ *
+ * \throws	Rethrows any error raised while decoding the file.
+ */
+const DecodedImage& DecodedImageCache::get(const std::string& filename)
+{
+	auto it = mImages.find(filename);
+	if (it == mImages.end())
+	{
+		std::promise<DecodedImage> decoded;
+		decoded.set_value(DecodedImage{filename});
+		it = mImages.emplace(filename, decoded.get_future().share()).first;
+	}
+
+	return it->second.get();
+}
+
+
+/**
+ * Drops all decoded images. Waits on any still being decoded.
+ */
+void DecodedImageCache::clear()
+{
+	mImages.clear();
+}
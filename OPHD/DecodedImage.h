@@ -0,0 +1,58 @@
+#pragma once
+
+#include <NAS2D/Renderer/Color.h>
+#include <NAS2D/Renderer/Point.h>
+#include <NAS2D/Renderer/Vector.h>
+#include <NAS2D/Resource/Image.h>
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/**
+ * Pixels of an image file decoded on the CPU without making a texture.
+ *
+ * Decoding doesn't touch the renderer so it can be done on any thread.
+ * A texture is made from the pixels with upload().
+ */
+class DecodedImage
+{
+public:
+	explicit DecodedImage(const std::string& filename);
+
+	NAS2D::Vector<int> size() const { return mSize; }
+	NAS2D::Color pixelColor(NAS2D::Point<int> point) const;
+
+	std::unique_ptr<NAS2D::Image> upload() const;
+
+private:
+	NAS2D::Vector<int> mSize;
+	std::vector<std::uint8_t> mPixels; /**< RGBA, row by row. */
+};
+
+
+/**
+ * Decodes image files on worker threads ahead of when they're needed.
+ *
+ * Files asked for together with preload() are decoded side by side.
+ * Decoded images are kept until clear() so several users of the same
+ * file only decode it once.
+ *
+ * \note	Not thread safe. Only call from the main thread, the workers
+ *			are managed internally.
+ */
+class DecodedImageCache
+{
+public:
+	void preload(const std::vector<std::string>& filenames);
+	const DecodedImage& get(const std::string& filename);
+
+	void clear();
+
+private:
+	std::map<std::string, std::shared_future<DecodedImage>> mImages;
+};
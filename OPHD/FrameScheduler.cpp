@@ -0,0 +1,73 @@
+#include "FrameScheduler.h"
+
+#include <NAS2D/Utility.h>
+#include <NAS2D/Renderer/Renderer.h>
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>
+
+
+namespace
+{
+	// Upper bound on how long an idle frame waits so anything polled
+	// from a state's update still gets looked at now and then.
+	const FrameScheduler::Duration MaxIdleInterval{1000};
+}
+
+
+/**
+ * Marks the frame being drawn as one that doesn't need redrawing
+ * unless something changes.
+ */
+void FrameScheduler::allowIdle()
+{
+	mIdleAllowed = true;
+}
+
+
+/**
+ * Requests that the next frame is drawn without waiting.
+ */
+void FrameScheduler::invalidate()
+{
+	mInvalidated = true;
+}
+
+
+/**
+ * Requests that the next frame is drawn no later than \c interval
+ * after the start of the frame being drawn.
+ */
+void FrameScheduler::animate(Duration interval)
+{
+	mAnimationInterval = std::min(mAnimationInterval, interval);
+}
+
+
+/**
+ * Blocks until the next frame should be drawn.
+ *
+ * Waiting is done on the SDL event queue so any input or window event
+ * ends the wait right away. Events are left in the queue for the next
+ * frame to handle.
+ */
+void FrameScheduler::waitForNextFrame()
+{
+	const bool canIdle = mEnabled && mIdleAllowed && !mInvalidated && !NAS2D::Utility<NAS2D::Renderer>::get().isFading();
+
+	if (canIdle)
+	{
+		const auto deadline = mFrameStart + std::min(mAnimationInterval, MaxIdleInterval);
+		const auto remaining = std::chrono::duration_cast<Duration>(deadline - Clock::now());
+		if (remaining.count() > 0)
+		{
+			SDL_WaitEventTimeout(nullptr, static_cast<int>(remaining.count()));
+		}
+	}
+
+	mIdleAllowed = false;
+	mInvalidated = false;
+	mAnimationInterval = Duration::max();
+	mFrameStart = Clock::now();
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+
+
+/**
+ * Decides when the main loop draws the next frame.
+ *
+ * While disabled every frame is drawn at full rate. When enabled, a
+ * state that calls allowIdle() during its update is not redrawn until
+ * there is input, something calls invalidate(), or an animation asks to
+ * be redrawn with animate(). States that never call allowIdle() keep
+ * drawing at full rate.
+ *
+ * Requests only apply to the frame being drawn and are cleared by
+ * waitForNextFrame().
+ */
+class FrameScheduler
+{
+public:
+	using Duration = std::chrono::milliseconds;
+
+	void enabled(bool enabled) { mEnabled = enabled; }
+	bool enabled() const { return mEnabled; }
+
+	void allowIdle();
+	void invalidate();
+	void animate(Duration interval);
+
+	void waitForNextFrame();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	bool mEnabled = false;
+	bool mIdleAllowed = false;
+	bool mInvalidated = true;
+	Duration mAnimationInterval = Duration::max();
+	Clock::time_point mFrameStart = Clock::now();
+};
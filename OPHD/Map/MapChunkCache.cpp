@@ -0,0 +1,302 @@
+#include "MapChunkCache.h"
+
+#include "TileMap.h"
+
+#include "../Common.h"
+#include "../StructureManager.h"
+#include "../Things/Structures/Structure.h"
+
+#include <NAS2D/Utility.h>
+#include <NAS2D/Renderer/Color.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+
+namespace
+{
+	// Capacity until the view reports how many chunks it shows
+	const std::size_t MinimumCachedChunks = 64;
+
+
+	/**
+	 * Shrinks an image by an integer factor. Colors are averaged weighted
+	 * by alpha so transparent pixels don't darken the edges of tiles.
+	 */
+	std::vector<std::uint8_t> downscale(const NAS2D::Image& image, int scale, NAS2D::Vector<int>& scaledSize)
+	{
+		scaledSize = image.size() / scale;
+		std::vector<std::uint8_t> pixels(static_cast<std::size_t>(scaledSize.x * scaledSize.y) * 4, 0);
+
+		for (int y = 0; y < scaledSize.y; ++y)
+		{
+			for (int x = 0; x < scaledSize.x; ++x)
+			{
+				int red = 0, green = 0, blue = 0, alpha = 0;
+				for (int sy = 0; sy < scale; ++sy)
+				{
+					for (int sx = 0; sx < scale; ++sx)
+					{
+						const auto color = image.pixelColor({x * scale + sx, y * scale + sy});
+						red += color.red * color.alpha;
+						green += color.green * color.alpha;
+						blue += color.blue * color.alpha;
+						alpha += color.alpha;
+					}
+				}
+
+				const auto offset = static_cast<std::size_t>(y * scaledSize.x + x) * 4;
+				if (alpha > 0)
+				{
+					pixels[offset] = static_cast<std::uint8_t>(red / alpha);
+					pixels[offset + 1] = static_cast<std::uint8_t>(green / alpha);
+					pixels[offset + 2] = static_cast<std::uint8_t>(blue / alpha);
+					pixels[offset + 3] = static_cast<std::uint8_t>(alpha / (scale * scale));
+				}
+			}
+		}
+
+		return pixels;
+	}
+
+
+	/**
+	 * Copy of a tileset with every pixel outside the top face of its tile
+	 * made transparent.
+	 */
+	std::vector<std::uint8_t> tileTopPixels(const std::vector<std::uint8_t>& tilesetPixels, NAS2D::Vector<int> tilesetSize, const TileGeometry& geometry)
+	{
+		auto pixels = tilesetPixels;
+		const int halfWidth = geometry.halfWidth;
+		const int halfHeight = geometry.halfHeightAbsolute;
+
+		for (int y = 0; y < tilesetSize.y; ++y)
+		{
+			for (int x = 0; x < tilesetSize.x; ++x)
+			{
+				// Measured from pixel centers so the face is symmetrical
+				const int dx = std::abs(2 * (x % geometry.width) + 1 - 2 * halfWidth);
+				const int dy = std::abs(2 * (y % geometry.height) + 1 - 2 * halfHeight);
+				if (dx * halfHeight + dy * halfWidth > 2 * halfWidth * halfHeight)
+				{
+					pixels[static_cast<std::size_t>(y * tilesetSize.x + x) * 4 + 3] = 0;
+				}
+			}
+		}
+
+		return pixels;
+	}
+
+
+	void blendPixel(std::uint8_t* destination, int red, int green, int blue, int alpha)
+	{
+		const int inverse = 255 - alpha;
+		destination[0] = static_cast<std::uint8_t>((red * alpha + destination[0] * inverse) / 255);
+		destination[1] = static_cast<std::uint8_t>((green * alpha + destination[1] * inverse) / 255);
+		destination[2] = static_cast<std::uint8_t>((blue * alpha + destination[2] * inverse) / 255);
+		destination[3] = static_cast<std::uint8_t>(alpha + destination[3] * inverse / 255);
+	}
+
+
+	/**
+	 * Color of the marker drawn on a tile in place of what occupies it.
+	 * Tiles with nothing to mark get a fully transparent color.
+	 */
+	NAS2D::Color markerColor(Tile& tile)
+	{
+		if (tile.thingIsStructure()) { return structureColorFromIndex(tile.structure()->state()); }
+		if (tile.thingIsRobot()) { return NAS2D::Color::Cyan; }
+		if (tile.mine()) { return NAS2D::Color::Yellow; }
+		return NAS2D::Color{0, 0, 0, 0};
+	}
+}
+
+
+/**
+ * \param	tileset		Full size tileset the map is normally drawn with.
+ * \param	geometry	Tile dimensions at the zoom level this cache draws.
+ * \param	scale		How many times smaller than full size tiles are.
+ * \param	edgeLength	Tiles along each edge of a chunk.
+ * \param	layer		What the chunks show on top of the terrain.
+ *
+ * \throws	std::runtime_error if edgeLength doesn't divide ChunkEdgeLength.
+ */
+MapChunkCache::MapChunkCache(const NAS2D::Image& tileset, const TileGeometry& geometry, int scale, int edgeLength, Layer layer) :
+	mGeometry{geometry},
+	mEdgeLength{edgeLength},
+	mLayer{layer},
+	mTilesetPixels{downscale(tileset, scale, mTilesetSize)},
+	mTilesetImage{std::make_unique<NAS2D::Image>(mTilesetPixels.data(), 4, mTilesetSize)},
+	mCapacity{MinimumCachedChunks}
+{
+	if (edgeLength <= 0 || ChunkEdgeLength % edgeLength != 0)
+	{
+		throw std::runtime_error("MapChunkCache::MapChunkCache(): Edge length must divide " + std::to_string(ChunkEdgeLength) + ".");
+	}
+
+	auto tops = tileTopPixels(mTilesetPixels, mTilesetSize, mGeometry);
+	mTileTopsImage = std::make_unique<NAS2D::Image>(tops.data(), 4, mTilesetSize);
+}
+
+
+/**
+ * Offset from the screen position of a chunk's first tile to where the
+ * chunk image is drawn.
+ */
+NAS2D::Vector<int> MapChunkCache::chunkOffset() const
+{
+	return {-(mEdgeLength - 1) * mGeometry.halfWidth, 0};
+}
+
+
+NAS2D::Vector<int> MapChunkCache::chunkSize() const
+{
+	return {mEdgeLength * mGeometry.width, (mEdgeLength - 1) * 2 * mGeometry.halfHeightAbsolute + mGeometry.height};
+}
+
+
+/**
+ * Sets how many chunks are kept. Chunks past the capacity are evicted the
+ * next time a chunk is added.
+ */
+void MapChunkCache::capacity(std::size_t capacity)
+{
+	mCapacity = std::max(capacity, MinimumCachedChunks);
+}
+
+
+/**
+ * Gets the image of a chunk, building it if it isn't cached or the tiles
+ * it covers have changed since it was built.
+ *
+ * \param	chunkPosition	Position of the chunk in chunks, not tiles.
+ *
+ * \warning	The returned reference is only good until the next call since
+ *			requesting another chunk can evict this one.
+ */
+const NAS2D::Image& MapChunkCache::chunk(TileMap& tileMap, NAS2D::Point<int> chunkPosition, int depth)
+{
+	const ChunkKey key{chunkPosition.x, chunkPosition.y, depth};
+	auto it = mChunks.find(key);
+	if (it == mChunks.end())
+	{
+		while (mChunks.size() >= mCapacity) { evictLeastRecentlyUsed(); }
+		it = mChunks.emplace(key, Chunk{}).first;
+	}
+
+	auto& chunk = it->second;
+	const auto structureChangeCount = NAS2D::Utility<StructureManager>::get().changeCount();
+
+	// Structures are only looked at once the tiles are known to be unchanged since removing one changes its tile
+	const bool stale = !chunk.image ||
+		chunk.revision != revision(tileMap, chunkPosition, depth) ||
+		(chunk.structureChangeCount != structureChangeCount && structureStateChanged(chunk));
+
+	if (stale)
+	{
+		const auto firstTile = NAS2D::Point{chunkPosition.x * mEdgeLength, chunkPosition.y * mEdgeLength};
+		chunk.image = buildChunk(tileMap, firstTile, depth, chunk.structures);
+
+		// Read after building since building can load the level, which sets up its tiles
+		chunk.revision = revision(tileMap, chunkPosition, depth);
+	}
+
+	chunk.structureChangeCount = structureChangeCount;
+	chunk.lastUsed = ++mUseCounter;
+	return *chunk.image;
+}
+
+
+void MapChunkCache::clear()
+{
+	mChunks.clear();
+}
+
+
+/**
+ * Gets the TileMap's revision of the block of tiles a chunk is in.
+ *
+ * \note	Chunks smaller than ChunkEdgeLength share a revision with the
+ *			other chunks in their block so they're rebuilt together.
+ */
+std::uint32_t MapChunkCache::revision(TileMap& tileMap, NAS2D::Point<int> chunkPosition, int depth) const
+{
+	const int chunksPerBlock = ChunkEdgeLength / mEdgeLength;
+	return tileMap.chunkRevision({chunkPosition.x / chunksPerBlock, chunkPosition.y / chunksPerBlock}, depth);
+}
+
+
+bool MapChunkCache::structureStateChanged(const Chunk& chunk)
+{
+	return std::any_of(chunk.structures.begin(), chunk.structures.end(), [](const StructureMarker& marker) { return marker.structure->state() != marker.state; });
+}
+
+
+/**
+ * Composes the tiles of a chunk in the same order TileMap draws them so
+ * overlapping tiles stack the same way.
+ *
+ * \param	structures	Filled with the structures in the chunk and the
+ *						state each marker is drawn for.
+ */
+std::unique_ptr<NAS2D::Image> MapChunkCache::buildChunk(TileMap& tileMap, NAS2D::Point<int> firstTile, int depth, std::vector<StructureMarker>& structures) const
+{
+	structures.clear();
+
+	const auto size = chunkSize();
+	std::vector<std::uint8_t> pixels(static_cast<std::size_t>(size.x * size.y) * 4, 0);
+
+	const int tilesetRow = depth > 0 ? mGeometry.height : 0;
+	const int halfWidth = mGeometry.halfWidth;
+	const int halfHeight = mGeometry.halfHeightAbsolute;
+
+	for (int row = 0; row < mEdgeLength; ++row)
+	{
+		for (int col = 0; col < mEdgeLength; ++col)
+		{
+			const auto mapPosition = firstTile + NAS2D::Vector{col, row};
+			if (!tileMap.isValidPosition(mapPosition, depth)) { continue; }
+
+			auto& tile = tileMap.getTile(mapPosition, depth);
+			if (!tile.excavated()) { continue; }
+
+			const auto tileOrigin = NAS2D::Point{(col - row + mEdgeLength - 1) * halfWidth, (col + row) * halfHeight};
+			const auto sourceOrigin = NAS2D::Point{static_cast<int>(tile.index()) * mGeometry.width, tilesetRow};
+			const auto& tint = overlayColor(tile.overlay());
+			const auto marker = mLayer == Layer::TerrainAndMarkers ? markerColor(tile) : NAS2D::Color{0, 0, 0, 0};
+			if (mLayer == Layer::TerrainAndMarkers && tile.thingIsStructure()) { structures.push_back({tile.structure(), tile.structure()->state()}); }
+
+			for (int y = 0; y < mGeometry.height; ++y)
+			{
+				for (int x = 0; x < mGeometry.width; ++x)
+				{
+					const auto* source = &mTilesetPixels[static_cast<std::size_t>((sourceOrigin.y + y) * mTilesetSize.x + sourceOrigin.x + x) * 4];
+					auto* destination = &pixels[static_cast<std::size_t>((tileOrigin.y + y) * size.x + tileOrigin.x + x) * 4];
+
+					if (source[3] != 0)
+					{
+						blendPixel(destination, source[0] * tint.red / 255, source[1] * tint.green / 255, source[2] * tint.blue / 255, source[3] * tint.alpha / 255);
+					}
+
+					// Markers fill the middle of the tile's top face
+					const bool insideMarker = 2 * (std::abs(x - halfWidth) * halfHeight + std::abs(y - halfHeight) * halfWidth) <= halfWidth * halfHeight;
+					if (marker.alpha != 0 && insideMarker)
+					{
+						blendPixel(destination, marker.red, marker.green, marker.blue, marker.alpha);
+					}
+				}
+			}
+		}
+	}
+
+	return std::make_unique<NAS2D::Image>(pixels.data(), 4, size);
+}
+
+
+void MapChunkCache::evictLeastRecentlyUsed()
+{
+	const auto oldest = std::min_element(mChunks.begin(), mChunks.end(), [](const auto& a, const auto& b) { return a.second.lastUsed < b.second.lastUsed; });
+	if (oldest != mChunks.end()) { mChunks.erase(oldest); }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <NAS2D/Renderer/Point.h>
+#include <NAS2D/Renderer/Vector.h>
+#include <NAS2D/Resource/Image.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+
+class Structure;
+class TileMap;
+enum class StructureState;
+
+
+/**
+ * Screen space dimensions of a tile at one zoom level.
+ */
+struct TileGeometry
+{
+	int width;
+	int height;
+	int halfWidth;
+	int heightAbsolute; /**< Height of the tile's top face. */
+	int halfHeightAbsolute; /**< Vertical distance between adjacent tiles. */
+};
+
+
+/**
+ * Pre-rendered images of square blocks of tiles used to draw the map's
+ * terrain.
+ *
+ * Each chunk holds edgeLength() x edgeLength() tiles composed from a copy
+ * of the tileset scaled to the zoom level, tinted by each tile's overlay.
+ * Zoomed out maps also get markers where structures, robots and mines are
+ * in place of drawing them. Drawing the terrain then costs one draw call
+ * per chunk instead of one per tile.
+ *
+ * Chunks remember the TileMap's revision of their tiles when they were
+ * built and are rebuilt the next time they're requested after any of those
+ * tiles change. Structure markers are colored by state, which isn't part of
+ * a tile, so chunks with structures also check those structures' states
+ * after the StructureManager reports a change.
+ *
+ * The cache holds up to capacity() chunks and evicts the least recently
+ * used one past that. The capacity should be set from how many chunks the
+ * view can show so chunks on screen are never evicted.
+ *
+ * \note	Chunks are composed on the CPU from the tileset's pixels and
+ *			uploaded as one image each.
+ */
+class MapChunkCache
+{
+public:
+	/** Largest chunk edge length. TileMap keeps tile revisions for blocks of this many tiles. */
+	static constexpr int ChunkEdgeLength = 16;
+
+	/** What chunks show on top of the terrain. */
+	enum class Layer
+	{
+		Terrain, /**< Nothing, things are drawn over the chunks. */
+		TerrainAndMarkers /**< A marker on every tile with a structure, robot or mine. */
+	};
+
+	MapChunkCache(const NAS2D::Image& tileset, const TileGeometry& geometry, int scale, int edgeLength, Layer layer);
+	MapChunkCache(const MapChunkCache&) = delete;
+	MapChunkCache& operator=(const MapChunkCache&) = delete;
+
+	const NAS2D::Image& chunk(TileMap& tileMap, NAS2D::Point<int> chunkPosition, int depth);
+
+	int edgeLength() const { return mEdgeLength; }
+	NAS2D::Vector<int> chunkOffset() const;
+	NAS2D::Vector<int> chunkSize() const;
+
+	const NAS2D::Image& tileset() const { return *mTilesetImage; }
+	const NAS2D::Image& tileTops() const { return *mTileTopsImage; }
+
+	std::size_t size() const { return mChunks.size(); }
+	std::size_t capacity() const { return mCapacity; }
+	void capacity(std::size_t capacity);
+	void clear();
+
+private:
+	using ChunkKey = std::tuple<int, int, int>;
+
+	/** A structure drawn in a chunk and the state its marker was drawn for. */
+	struct StructureMarker
+	{
+		const Structure* structure;
+		StructureState state;
+	};
+
+	struct Chunk
+	{
+		std::unique_ptr<NAS2D::Image> image;
+		std::uint32_t revision = 0;
+		unsigned int structureChangeCount = 0;
+		std::vector<StructureMarker> structures;
+		std::uint64_t lastUsed = 0;
+	};
+
+	std::unique_ptr<NAS2D::Image> buildChunk(TileMap& tileMap, NAS2D::Point<int> firstTile, int depth, std::vector<StructureMarker>& structures) const;
+	std::uint32_t revision(TileMap& tileMap, NAS2D::Point<int> chunkPosition, int depth) const;
+	static bool structureStateChanged(const Chunk& chunk);
+	void evictLeastRecentlyUsed();
+
+	TileGeometry mGeometry;
+	int mEdgeLength;
+	Layer mLayer;
+
+	NAS2D::Vector<int> mTilesetSize;
+	std::vector<std::uint8_t> mTilesetPixels; /**< Scaled down tileset, RGBA. */
+	std::unique_ptr<NAS2D::Image> mTilesetImage;
+	std::unique_ptr<NAS2D::Image> mTileTopsImage; /**< Scaled tileset with only each tile's top face. */
+
+	std::map<ChunkKey, Chunk> mChunks;
+	std::size_t mCapacity;
+	std::uint64_t mUseCounter = 0;
+};
@@ -0,0 +1,142 @@
+#include "MineLocationIndex.h"
+
+#include <NAS2D/Renderer/Vector.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace
+{
+	/** Rounds toward negative infinity so cells left of and above 0 don't share cell 0. */
+	int floorDivide(int value, int divisor)
+	{
+		const int quotient = value / divisor;
+		return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+	}
+}
+
+
+/**
+ * \param	cellSize	Width and height of the spatial hash cells in tiles.
+ *						Works best around the radius most queries use.
+ *
+ * \throws	std::runtime_error if cellSize is less than 1.
+ */
+MineLocationIndex::MineLocationIndex(int cellSize) :
+	mCellSize{cellSize}
+{
+	if (mCellSize < 1)
+	{
+		throw std::runtime_error("MineLocationIndex::MineLocationIndex(): Cell size must be at least 1.");
+	}
+}
+
+
+/**
+ * Adds a mine location. Does nothing if the location is already in the index.
+ */
+void MineLocationIndex::add(NAS2D::Point<int> location)
+{
+	if (!mLocationIndex.try_emplace(key(location), mLocations.size()).second) { return; }
+
+	mLocations.push_back(location);
+	mCells[key(cellFromLocation(location))].push_back(location);
+}
+
+
+/**
+ * Removes a mine location.
+ *
+ * \return	Returns false if the location wasn't in the index.
+ */
+bool MineLocationIndex::remove(NAS2D::Point<int> location)
+{
+	const auto it = mLocationIndex.find(key(location));
+	if (it == mLocationIndex.end()) { return false; }
+
+	const auto index = it->second;
+	mLocationIndex.erase(it);
+
+	if (index != mLocations.size() - 1)
+	{
+		mLocations[index] = mLocations.back();
+		mLocationIndex[key(mLocations[index])] = index;
+	}
+	mLocations.pop_back();
+
+	const auto cell = mCells.find(key(cellFromLocation(location)));
+	auto& cellLocations = cell->second;
+	cellLocations.erase(std::find(cellLocations.begin(), cellLocations.end(), location));
+	if (cellLocations.empty()) { mCells.erase(cell); }
+
+	return true;
+}
+
+
+void MineLocationIndex::clear()
+{
+	mLocations.clear();
+	mLocationIndex.clear();
+	mCells.clear();
+}
+
+
+MineLocationIndex::Key MineLocationIndex::key(NAS2D::Point<int> point)
+{
+	return (static_cast<Key>(static_cast<std::uint32_t>(point.x)) << 32) | static_cast<std::uint32_t>(point.y);
+}
+
+
+NAS2D::Point<int> MineLocationIndex::cellFromLocation(NAS2D::Point<int> location) const
+{
+	return {floorDivide(location.x, mCellSize), floorDivide(location.y, mCellSize)};
+}
+
+
+/**
+ * Calls function with each location within radius of center until it
+ * returns false.
+ */
+template <typename Function>
+void MineLocationIndex::forEachWithin(NAS2D::Point<int> center, int radius, Function function) const
+{
+	const auto firstCell = cellFromLocation(center - NAS2D::Vector{radius, radius});
+	const auto lastCell = cellFromLocation(center + NAS2D::Vector{radius, radius});
+	const auto radiusSquared = radius * radius;
+
+	for (int y = firstCell.y; y <= lastCell.y; ++y)
+	{
+		for (int x = firstCell.x; x <= lastCell.x; ++x)
+		{
+			const auto cell = mCells.find(key({x, y}));
+			if (cell == mCells.end()) { continue; }
+
+			for (const auto location : cell->second)
+			{
+				const auto offset = location - center;
+				if (offset.x * offset.x + offset.y * offset.y > radiusSquared) { continue; }
+				if (!function(location)) { return; }
+			}
+		}
+	}
+}
+
+
+bool MineLocationIndex::contains(NAS2D::Point<int> location) const
+{
+	return mLocationIndex.find(key(location)) != mLocationIndex.end();
+}
+
+
+/**
+ * Gets whether any mine is within radius tiles of center, measured in a
+ * straight line.
+ */
+bool MineLocationIndex::anyWithin(NAS2D::Point<int> center, int radius) const
+{
+	bool found = false;
+	forEachWithin(center, radius, [&found](NAS2D::Point<int>) { found = true; return false; });
+	return found;
+}
+
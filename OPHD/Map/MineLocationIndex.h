@@ -0,0 +1,52 @@
+#pragma once
+
+#include <NAS2D/Renderer/Point.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * Set of mine locations on the surface with a spatial hash for finding the
+ * mines near a point.
+ *
+ * Locations are kept in a flat list for iterating over and a hash from
+ * location to list position so removing one doesn't need a search. The
+ * spatial hash buckets locations into square cells so a radius query only
+ * looks at the cells the radius overlaps.
+ *
+ * \note	Removing a location moves the last location into its place so
+ *			locations() isn't kept in the order locations were added.
+ */
+class MineLocationIndex
+{
+public:
+	explicit MineLocationIndex(int cellSize = 8);
+
+	void add(NAS2D::Point<int> location);
+	bool remove(NAS2D::Point<int> location);
+	void clear();
+
+	bool contains(NAS2D::Point<int> location) const;
+	bool anyWithin(NAS2D::Point<int> center, int radius) const;
+
+	const std::vector<NAS2D::Point<int>>& locations() const { return mLocations; }
+	std::size_t size() const { return mLocations.size(); }
+	bool empty() const { return mLocations.empty(); }
+
+private:
+	using Key = std::uint64_t;
+
+	static Key key(NAS2D::Point<int> point);
+	NAS2D::Point<int> cellFromLocation(NAS2D::Point<int> location) const;
+
+	template <typename Function>
+	void forEachWithin(NAS2D::Point<int> center, int radius, Function function) const;
+
+	int mCellSize;
+
+	std::vector<NAS2D::Point<int>> mLocations;
+	std::unordered_map<Key, std::size_t> mLocationIndex; /**< Position of each location in mLocations. */
+	std::unordered_map<Key, std::vector<NAS2D::Point<int>>> mCells;
+};
@@ -4,26 +4,31 @@
 #include "../Things/Robots/Robot.h"
 #include "../Things/Structures/Structure.h"
 
+#include <array>
 #include <cmath>
 
 
-std::map<Tile::Overlay, NAS2D::Color> OverlayColorTable =
+namespace
 {
-	{ Tile::Overlay::None, NAS2D::Color::Normal },
-	{ Tile::Overlay::Communications, { 125, 200, 255 } },
-	{ Tile::Overlay::Connectedness, NAS2D::Color::Green },
-	{ Tile::Overlay::TruckingRoutes, NAS2D::Color::Orange },
-	{ Tile::Overlay::Police, NAS2D::Color::Red }
-};
-
-std::map<Tile::Overlay, NAS2D::Color> OverlayHighlightColorTable =
-{
-	{ Tile::Overlay::None, NAS2D::Color{ 125, 200, 255 } },
-	{ Tile::Overlay::Communications, { 100, 180, 230 } },
-	{ Tile::Overlay::Connectedness, NAS2D::Color{ 71, 224, 146 } },
-	{ Tile::Overlay::TruckingRoutes, NAS2D::Color{ 125, 200, 255 } },
-	{ Tile::Overlay::Police, NAS2D::Color{ 100, 180, 230} }
-};
+	/** Colors indexed by Tile::Overlay. Must match the order of the enumeration. */
+	const std::array<NAS2D::Color, 5> OverlayColorTable =
+	{
+		NAS2D::Color{ 125, 200, 255 }, // Communications
+		NAS2D::Color::Green, // Connectedness
+		NAS2D::Color::Orange, // TruckingRoutes
+		NAS2D::Color::Red, // Police
+		NAS2D::Color::Normal // None
+	};
+
+	const std::array<NAS2D::Color, 5> OverlayHighlightColorTable =
+	{
+		NAS2D::Color{ 100, 180, 230 }, // Communications
+		NAS2D::Color{ 71, 224, 146 }, // Connectedness
+		NAS2D::Color{ 125, 200, 255 }, // TruckingRoutes
+		NAS2D::Color{ 100, 180, 230 }, // Police
+		NAS2D::Color{ 125, 200, 255 } // None
+	};
+}
 
 
 const NAS2D::Color& overlayColor(Tile::Overlay overlay, bool isHighlighted)
@@ -39,13 +44,13 @@ const NAS2D::Color& overlayColor(Tile::Overlay overlay, bool isHighlighted)
 
 const NAS2D::Color& overlayColor(Tile::Overlay overlay)
 {
-	return OverlayColorTable.at(overlay);
+	return OverlayColorTable[static_cast<std::size_t>(overlay)];
 }
 
 
 const NAS2D::Color& overlayHighlightColor(Tile::Overlay overlay)
 {
-	return OverlayHighlightColorTable.at(overlay);
+	return OverlayHighlightColorTable[static_cast<std::size_t>(overlay)];
 }
 
 
@@ -63,6 +68,7 @@ Tile::Tile(Tile&& other) noexcept :
 	mThing{other.mThing},
 	mMine{other.mMine},
 	mOverlay{other.mOverlay},
+	mRevisionCounter{other.mRevisionCounter},
 	mExcavated{other.mExcavated}
 {
 	other.mThing = nullptr;
@@ -78,6 +84,7 @@ Tile& Tile::operator=(Tile&& other) noexcept
 	mThing = other.mThing;
 	mMine = other.mMine;
 	mOverlay = other.mOverlay;
+	mRevisionCounter = other.mRevisionCounter;
 	mExcavated = other.mExcavated;
 
 	other.mThing = nullptr;
@@ -89,8 +96,9 @@ Tile& Tile::operator=(Tile&& other) noexcept
 
 Tile::~Tile()
 {
-	delete mMine;
+	// A MineFacility listens to the Mine under it so it has to go first
 	delete mThing;
+	delete mMine;
 }
 
 
@@ -107,6 +115,7 @@ void Tile::pushThing(Thing* thing)
 	}
 
 	mThing = thing;
+	changed();
 }
 
 
@@ -130,6 +139,7 @@ void Tile::deleteThing()
 void Tile::removeThing()
 {
 	mThing = nullptr;
+	changed();
 }
 
 
@@ -137,6 +147,7 @@ void Tile::pushMine(Mine* mine)
 {
 	delete mMine;
 	mMine = mine;
+	changed();
 }
 
 
@@ -5,6 +5,8 @@
 #include <NAS2D/Renderer/Point.h>
 #include <NAS2D/Renderer/Vector.h>
 
+#include <cstdint>
+
 
 class Mine;
 class Thing;
@@ -35,7 +37,7 @@ public:
 	~Tile();
 
 	TerrainType index() const { return mIndex; }
-	void index(TerrainType index) { mIndex = index; }
+	void index(TerrainType index) { mIndex = index; changed(); }
 
 	NAS2D::Point<int> position() const { return mPosition; }
 
@@ -45,7 +47,7 @@ public:
 	bool bulldozed() const { return index() == TerrainType::Dozed; }
 
 	bool excavated() const { return mExcavated; }
-	void excavated(bool value) { mExcavated = value; }
+	void excavated(bool value) { mExcavated = value; changed(); }
 
 	bool connected() const { return mConnected; }
 	void connected(bool value) { mConnected = value; }
@@ -70,10 +72,18 @@ public:
 	Mine* mine() { return mMine; }
 	void pushMine(Mine*);
 
-	void overlay(Overlay overlay) { mOverlay = overlay; }
+	void overlay(Overlay overlay) { mOverlay = overlay; changed(); }
 	Overlay overlay() const { return mOverlay; }
 
+	/**
+	 * Sets a counter that's incremented whenever anything that changes how
+	 * the tile looks is changed. Tiles in the same map chunk share one.
+	 */
+	void revisionCounter(std::uint32_t* counter) { mRevisionCounter = counter; }
+
 private:
+	void changed() { if (mRevisionCounter) { ++*mRevisionCounter; } }
+
 	TerrainType mIndex = TerrainType::Dozed;
 
 	NAS2D::Point<int> mPosition; /**< Tile Position Information */
@@ -84,6 +94,8 @@ private:
 
 	Overlay mOverlay{ Overlay::None };
 
+	std::uint32_t* mRevisionCounter = nullptr;
+
 	bool mExcavated = true; /**< Used when a Digger uncovers underground tiles. */
 	bool mConnected = false; /**< Flag indicating that this tile is connected to the Command Center. */
 };
@@ -1,24 +1,28 @@
 #include "TileMap.h"
 
+#include "../Cache.h"
 #include "../Constants.h"
 #include "../DirectionOffset.h"
 #include "../Mine.h"
 #include "../Things/Structures/Structure.h"
 #include "../RandomNumberGenerator.h"
+#include "../StartupTimer.h"
 
 #include <NAS2D/Utility.h>
 #include <NAS2D/ParserHelper.h>
 #include <NAS2D/Xml/XmlElement.h>
 
 #include <algorithm>
-#include <functional>
 #include <array>
+#include <cmath>
 
 
 using namespace NAS2D;
 
 
 const std::string MAP_TERRAIN_EXTENSION = "_a.png";
+const std::string MINE_BEACON_PATH = "structures/mine_beacon.png";
+const std::string MOUSE_MAP_PATH = "ui/mouse_map.png";
 
 const int MAP_WIDTH = 300;
 const int MAP_HEIGHT = 150;
@@ -34,6 +38,21 @@ const int TILE_HEIGHT_HALF_ABSOLUTE = TILE_HEIGHT_ABSOLUTE / 2;
 
 const double THROB_SPEED = 250.0; // Throb speed of mine beacon
 
+const int MINE_MARGIN = 5; // Mines aren't placed within this many tiles of the map edge
+
+const int MAX_ZOOM_LEVEL = 2;
+
+// Full size chunks are a quarter the area of zoomed out ones so the chunks on screen use less texture memory
+const int FULL_SIZE_CHUNK_EDGE_LENGTH = MapChunkCache::ChunkEdgeLength / 2;
+
+/** Tile dimensions at each zoom level. Each level halves the size of the one before it. */
+const std::array<TileGeometry, MAX_ZOOM_LEVEL + 1> TILE_GEOMETRY =
+{{
+	{TILE_WIDTH, TILE_HEIGHT, TILE_HALF_WIDTH, TILE_HEIGHT_ABSOLUTE, TILE_HEIGHT_HALF_ABSOLUTE},
+	{TILE_WIDTH / 2, TILE_HEIGHT / 2, TILE_HALF_WIDTH / 2, 28, 14},
+	{TILE_WIDTH / 4, TILE_HEIGHT / 4, TILE_HALF_WIDTH / 4, 14, 7},
+}};
+
 /** Array indicates percent of mines that should be of yields LOW, MED, HIGH */
 const std::map<Planet::Hostility, std::array<int, 3>> HostilityMineYieldTable =
 {
@@ -43,20 +62,101 @@ const std::map<Planet::Hostility, std::array<int, 3>> HostilityMineYieldTable =
 };
 
 
-TileMap::TileMap(const std::string& mapPath, const std::string& tilesetPath, int maxDepth, int mineCount, Planet::Hostility hostility, bool shouldSetupMines) :
+namespace
+{
+	/**
+	 * Picks up to count random points in an area that are all farther than
+	 * spacing tiles apart using Poisson-disk sampling.
+	 *
+	 * Candidates are first drawn from the whole area and kept if nothing
+	 * already placed is too close, so even a few points are spread over
+	 * the area. Once candidates keep missing, Bridson's algorithm grows new
+	 * points around the placed ones to fill the gaps that are left. Either
+	 * way sampling stops as soon as there are enough points.
+	 *
+	 * \return	Points in random order. Fewer than count if the area fills up.
+	 */
+	Point2dList poissonDiskSample(const NAS2D::Rectangle<int>& area, int spacing, std::size_t count)
+	{
+		const int Attempts = 30;
+
+		MineLocationIndex placed(spacing);
+
+		const auto randomPoint = [&area]()
+		{
+			return NAS2D::Point{randomNumber.generate<int>(area.x, area.x + area.width - 1), randomNumber.generate<int>(area.y, area.y + area.height - 1)};
+		};
+
+		for (int misses = 0; placed.size() < count && misses < Attempts;)
+		{
+			const auto candidate = randomPoint();
+			if (placed.anyWithin(candidate, spacing)) { ++misses; continue; }
+
+			placed.add(candidate);
+			misses = 0;
+		}
+
+		Point2dList active = placed.locations();
+		while (placed.size() < count && !active.empty())
+		{
+			const auto index = randomNumber.generate<std::size_t>(0, active.size() - 1);
+			const auto center = active[index];
+
+			bool found = false;
+			for (int attempt = 0; attempt < Attempts && !found; ++attempt)
+			{
+				const auto angle = randomNumber.generate<float>(0.0f, 6.2831853f);
+				const auto distance = randomNumber.generate<float>(static_cast<float>(spacing + 1), static_cast<float>(2 * spacing + 1));
+				const auto candidate = center + NAS2D::Vector{static_cast<int>(std::lround(std::cos(angle) * distance)), static_cast<int>(std::lround(std::sin(angle) * distance))};
+
+				if (!area.contains(candidate) || placed.anyWithin(candidate, spacing)) { continue; }
+
+				placed.add(candidate);
+				active.push_back(candidate);
+				found = true;
+			}
+
+			if (!found)
+			{
+				active[index] = active.back();
+				active.pop_back();
+			}
+		}
+
+		// Points grown in the gaps come out last and next to each other
+		auto points = placed.locations();
+		for (std::size_t i = points.size(); i > 1; --i)
+		{
+			std::swap(points[i - 1], points[randomNumber.generate<std::size_t>(0, i - 1)]);
+		}
+		return points;
+	}
+}
+
+
+TileMap::TileMap(const std::string& mapPath, const std::string& tilesetPath, int maxDepth, int mineCount, int mineSpacing, Planet::Hostility hostility, bool shouldSetupMines) :
 	mSizeInTiles{MAP_WIDTH, MAP_HEIGHT},
 	mMaxDepth(maxDepth),
 	mMapPath(mapPath),
-	mTsetPath(tilesetPath),
-	mTileset(tilesetPath),
-	mMineBeacon("structures/mine_beacon.png")
+	mTsetPath(tilesetPath)
 {
 	std::cout << "Loading '" << mapPath << "'... ";
-	buildTerrainMap(mapPath);
-	buildMouseMap();
-	initMapDrawParams(Utility<Renderer>::get().size());
-
-	if (shouldSetupMines) { setupMines(mineCount, hostility); }
+	{
+		// Decoded side by side on workers, textures are made here as each is ready
+		StartupTimer::Stage stage{"Map images"};
+		decodedImageCache.preload({mapPath + MAP_TERRAIN_EXTENSION, tilesetPath, MINE_BEACON_PATH, MOUSE_MAP_PATH});
+		mTileset = decodedImageCache.get(tilesetPath).upload();
+		mMineBeacon = decodedImageCache.get(MINE_BEACON_PATH).upload();
+
+		stage.next("Terrain map");
+		buildTerrainMap(mapPath);
+		stage.next("Mouse map");
+		buildMouseMap();
+		initMapDrawParams(Utility<Renderer>::get().size());
+
+		stage.next("Mine setup");
+		if (shouldSetupMines) { setupMines(mineCount, mineSpacing, hostility); }
+	}
 	std::cout << "finished!" << std::endl;
 }
 
@@ -69,7 +169,7 @@ TileMap::TileMap(const std::string& mapPath, const std::string& tilesetPath, int
  */
 void TileMap::removeMineLocation(const NAS2D::Point<int>& pt)
 {
-	mMineLocations.erase(find(mMineLocations.begin(), mMineLocations.end(), pt));
+	mMineLocations.remove(pt);
 	getTile(pt, 0).pushMine(nullptr);
 }
 
@@ -80,12 +180,27 @@ bool TileMap::isValidPosition(NAS2D::Point<int> position, int level) const
 }
 
 
+/**
+ * Indicates whether or not a level has been allocated.
+ *
+ * \note	Underground levels are allocated the first time any of
+ *			their tiles are requested.
+ */
+bool TileMap::isLevelLoaded(int level) const
+{
+	return level >= 0 && level <= mMaxDepth && !mTileMap[static_cast<std::size_t>(level)].empty();
+}
+
+
 Tile& TileMap::getTile(NAS2D::Point<int> position, int level)
 {
 	if (!isValidPosition(position, level))
 	{
 		throw std::runtime_error("Tile coordinates out of bounds: {" + std::to_string(position.x) + ", " + std::to_string(position.y) + ", " + std::to_string(level) + "}");
 	}
+
+	if (!isLevelLoaded(level)) { loadLevel(level); }
+
 	const auto mapPosition = position.to<std::size_t>();
 	return mTileMap[static_cast<std::size_t>(level)][mapPosition.y][mapPosition.x];
 }
@@ -93,21 +208,13 @@ Tile& TileMap::getTile(NAS2D::Point<int> position, int level)
 
 /**
  * Builds the terrain map.
+ *
+ * Only the surface level is allocated here. Underground levels
+ * are allocated by loadLevel() when they're first accessed.
  */
 void TileMap::buildTerrainMap(const std::string& path)
 {
-	const Image heightmap(path + MAP_TERRAIN_EXTENSION);
-
-	const auto levelCount = static_cast<std::size_t>(mMaxDepth) + 1;
-	mTileMap.resize(levelCount);
-	for(std::size_t level = 0; level < levelCount; level++)
-	{
-		mTileMap[level].resize(static_cast<std::size_t>(mSizeInTiles.y));
-		for (std::size_t i = 0; i < mTileMap[level].size(); i++)
-		{
-			mTileMap[level][i].resize(static_cast<std::size_t>(mSizeInTiles.x));
-		}
-	}
+	const auto& heightmap = decodedImageCache.get(path + MAP_TERRAIN_EXTENSION);
 
 	/**
 	 * Builds a terrain map based on the pixel color values in
@@ -117,26 +224,77 @@ void TileMap::buildTerrainMap(const std::string& path)
 	 * that all channels are the same value so it only looks at the red.
 	 * Color values are divided by 50 to get a height value from 1 - 4.
 	 */
-	for(int depth = 0; depth <= mMaxDepth; depth++)
+	mTerrain.resize(static_cast<std::size_t>(mSizeInTiles.x * mSizeInTiles.y));
+	for(int row = 0; row < mSizeInTiles.y; row++)
 	{
-		for(int row = 0; row < mSizeInTiles.y; row++)
+		for(int col = 0; col < mSizeInTiles.x; col++)
 		{
-			for(int col = 0; col < mSizeInTiles.x; col++)
-			{
-				auto color = heightmap.pixelColor({col, row});
-				auto& tile = getTile({col, row}, depth);
-				tile = {{col, row}, depth, static_cast<TerrainType>(color.red / 50)};
-				if (depth > 0) { tile.excavated(false); }
-			}
+			auto color = heightmap.pixelColor({col, row});
+			mTerrain[static_cast<std::size_t>(row * mSizeInTiles.x + col)] = static_cast<TerrainType>(color.red / 50);
+		}
+	}
+
+	const auto levelCount = static_cast<std::size_t>(mMaxDepth) + 1;
+	mTileMap.resize(levelCount);
+	mPendingTiles.resize(levelCount);
+
+	const int chunkEdgeLength = MapChunkCache::ChunkEdgeLength;
+	mChunksPerRow = (mSizeInTiles.x + chunkEdgeLength - 1) / chunkEdgeLength;
+	const int chunksPerColumn = (mSizeInTiles.y + chunkEdgeLength - 1) / chunkEdgeLength;
+	mChunkRevisions.assign(levelCount, std::vector<std::uint32_t>(static_cast<std::size_t>(mChunksPerRow * chunksPerColumn), 0));
+
+	loadLevel(TileMapLevel::LEVEL_SURFACE);
+}
+
+
+/**
+ * Allocates and initializes a level from the decoded terrain and
+ * applies any tile records read from a saved game for that level.
+ *
+ * \note	Levels are allocated independently of each other so
+ *			loading a level never invalidates pointers to tiles
+ *			in other levels.
+ */
+void TileMap::loadLevel(int level)
+{
+	auto& grid = mTileMap[static_cast<std::size_t>(level)];
+	auto& chunkRevisions = mChunkRevisions[static_cast<std::size_t>(level)];
+	const int chunkEdgeLength = MapChunkCache::ChunkEdgeLength;
+
+	grid.resize(static_cast<std::size_t>(mSizeInTiles.y));
+	for(int row = 0; row < mSizeInTiles.y; row++)
+	{
+		auto& tileRow = grid[static_cast<std::size_t>(row)];
+		tileRow.resize(static_cast<std::size_t>(mSizeInTiles.x));
+		for(int col = 0; col < mSizeInTiles.x; col++)
+		{
+			auto& tile = tileRow[static_cast<std::size_t>(col)];
+			tile = {{col, row}, level, mTerrain[static_cast<std::size_t>(row * mSizeInTiles.x + col)]};
+			tile.revisionCounter(&chunkRevisions[static_cast<std::size_t>((row / chunkEdgeLength) * mChunksPerRow + col / chunkEdgeLength)]);
+			if (level > 0) { tile.excavated(false); }
 		}
 	}
+
+	auto& pendingTiles = mPendingTiles[static_cast<std::size_t>(level)];
+	for (const auto& [position, index] : pendingTiles)
+	{
+		auto& tile = grid[static_cast<std::size_t>(position.y)][static_cast<std::size_t>(position.x)];
+		tile.index(index);
+		if (level > 0) { tile.excavated(true); }
+	}
+	pendingTiles.clear();
+	pendingTiles.shrink_to_fit();
 }
 
 
 /**
  * Creates mining locations around the map area.
+ *
+ * \param	mineSpacing	Mines are placed farther than this many tiles apart.
+ *						If the map can't fit mineCount mines that far apart,
+ *						fewer mines are placed.
  */
-void TileMap::setupMines(int mineCount, Planet::Hostility hostility)
+void TileMap::setupMines(int mineCount, int mineSpacing, Planet::Hostility hostility)
 {
 	if (hostility == Planet::Hostility::None) { return; }
 
@@ -149,17 +307,16 @@ void TileMap::setupMines(int mineCount, Planet::Hostility hostility)
 	// low yield mines. Difficulty settings could shift this to other yields.
 	int yieldTotal = yieldLow + yieldMedium + yieldHigh;
 	if (yieldTotal < mineCount) { yieldLow += mineCount - yieldTotal; }
-	
-	auto mwidth = std::bind(&RandomNumberGenerator::generate<int>, &randomNumber, 5, MAP_WIDTH - 5);
-	auto mheight = std::bind(&RandomNumberGenerator::generate<int>, &randomNumber, 5, MAP_HEIGHT - 5);
 
-	auto randPoint = [&mwidth, &mheight]() { return NAS2D::Point{mwidth(), mheight()}; };
+	const auto mineArea = NAS2D::Rectangle{MINE_MARGIN, MINE_MARGIN, MAP_WIDTH - 2 * MINE_MARGIN + 1, MAP_HEIGHT - 2 * MINE_MARGIN + 1};
+	const auto locations = poissonDiskSample(mineArea, std::max(mineSpacing, 1), static_cast<std::size_t>(std::max(mineCount, 0)));
 
+	std::size_t next = 0;
 	auto generateMines = [&](int mineCountAtYield, MineProductionRate yield)
 	{
-		for (int i = 0; i < mineCountAtYield; ++i)
+		for (int i = 0; i < mineCountAtYield && next < locations.size(); ++i)
 		{
-			addMineSet(randPoint(), mMineLocations, yield);
+			placeMine(locations[next++], yield);
 		}
 	};
 
@@ -169,65 +326,57 @@ void TileMap::setupMines(int mineCount, Planet::Hostility hostility)
 }
 
 
-void TileMap::addMineSet(NAS2D::Point<int> suggestedMineLocation, Point2dList& plist, MineProductionRate rate)
+void TileMap::placeMine(NAS2D::Point<int> location, MineProductionRate rate)
 {
-	// Mines should not be right next to each other
-	// If mines are right next to each other, then overwrite the old location with the new mine parameters
-	const auto mineLocation = findSurroundingMineLocation(suggestedMineLocation);
-
-	auto& tile = getTile(mineLocation, 0);
+	auto& tile = getTile(location, 0);
 	tile.pushMine(new Mine(rate));
 	tile.index(TerrainType::Dozed);
 
-	plist.push_back(mineLocation);
-}
-
-
-NAS2D::Point<int> TileMap::findSurroundingMineLocation(NAS2D::Point<int> centerPoint)
-{
-	if (getTile(centerPoint, 0).hasMine())
-	{
-		for (const auto& direction : DirectionScan323)
-		{
-			const auto point = centerPoint + direction;
-			if (getTile(point, 0).hasMine()) { return point; }
-		}
-	}
-	return centerPoint;
+	mMineLocations.add(location);
 }
 
 
 /**
  * Build a logic map for determining what tile the mouse is pointing at.
+ *
+ * \note	The mouse map is the same for every TileMap so the image is
+ *			only decoded the first time a TileMap is built.
  */
 void TileMap::buildMouseMap()
 {
-	const Image mousemap("ui/mouse_map.png");
+	static std::vector<std::vector<MouseMapRegion>> mouseMapCache;
 
-	// More sanity checks (mousemap should match dimensions of tile)
-	if (mousemap.size() != Vector{TILE_WIDTH, TILE_HEIGHT_ABSOLUTE})
+	if (mouseMapCache.empty())
 	{
-		throw std::runtime_error("Mouse map is the wrong dimensions.");
-	}
+		const auto& mousemap = decodedImageCache.get(MOUSE_MAP_PATH);
 
-	mMouseMap.resize(TILE_HEIGHT_ABSOLUTE);
-	for (std::size_t i = 0; i < mMouseMap.size(); i++)
-	{
-		mMouseMap[i].resize(TILE_WIDTH);
-	}
+		// More sanity checks (mousemap should match dimensions of tile)
+		if (mousemap.size() != Vector{TILE_WIDTH, TILE_HEIGHT_ABSOLUTE})
+		{
+			throw std::runtime_error("Mouse map is the wrong dimensions.");
+		}
 
-	for(std::size_t row = 0; row < TILE_HEIGHT_ABSOLUTE; row++)
-	{
-		for(std::size_t col = 0; col < TILE_WIDTH; col++)
+		mouseMapCache.resize(TILE_HEIGHT_ABSOLUTE);
+		for (std::size_t i = 0; i < mouseMapCache.size(); i++)
+		{
+			mouseMapCache[i].resize(TILE_WIDTH);
+		}
+
+		for(std::size_t row = 0; row < TILE_HEIGHT_ABSOLUTE; row++)
 		{
-			const Color c = mousemap.pixelColor({static_cast<int>(col), static_cast<int>(row)});
-			if (c == NAS2D::Color::Yellow) { mMouseMap[row][col] = MouseMapRegion::MMR_BOTTOM_RIGHT; }
-			else if (c == NAS2D::Color::Red) { mMouseMap[row][col] = MouseMapRegion::MMR_TOP_LEFT; }
-			else if (c == NAS2D::Color::Blue) { mMouseMap[row][col] = MouseMapRegion::MMR_TOP_RIGHT; }
-			else if (c == NAS2D::Color::Green) { mMouseMap[row][col] = MouseMapRegion::MMR_BOTTOM_LEFT; }
-			else { mMouseMap[row][col] = MouseMapRegion::MMR_MIDDLE; }
+			for(std::size_t col = 0; col < TILE_WIDTH; col++)
+			{
+				const Color c = mousemap.pixelColor({static_cast<int>(col), static_cast<int>(row)});
+				if (c == NAS2D::Color::Yellow) { mouseMapCache[row][col] = MouseMapRegion::MMR_BOTTOM_RIGHT; }
+				else if (c == NAS2D::Color::Red) { mouseMapCache[row][col] = MouseMapRegion::MMR_TOP_LEFT; }
+				else if (c == NAS2D::Color::Blue) { mouseMapCache[row][col] = MouseMapRegion::MMR_TOP_RIGHT; }
+				else if (c == NAS2D::Color::Green) { mouseMapCache[row][col] = MouseMapRegion::MMR_BOTTOM_LEFT; }
+				else { mouseMapCache[row][col] = MouseMapRegion::MMR_MIDDLE; }
+			}
 		}
 	}
+
+	mMouseMap = mouseMapCache;
 }
 
 
@@ -236,14 +385,44 @@ void TileMap::buildMouseMap()
  */
 void TileMap::initMapDrawParams(NAS2D::Vector<int> size)
 {
+	mViewportSize = size;
+	const auto& geometry = tileGeometry();
+
 	// Set up map draw position
-	const auto lengthX = size.x / TILE_WIDTH;
-	const auto lengthY = size.y / TILE_HEIGHT_ABSOLUTE;
-	mEdgeLength = std::max(3, std::min(lengthX, lengthY));
+	const auto lengthX = size.x / geometry.width;
+	const auto lengthY = size.y / geometry.heightAbsolute;
+	mEdgeLength = std::clamp(std::min(lengthX, lengthY), 3, std::min(mSizeInTiles.x, mSizeInTiles.y));
 
 	// Find top left corner of rectangle containing top tile of diamond
-	mMapPosition = NAS2D::Point{(size.x - TILE_WIDTH) / 2, (size.y - constants::BottomUiHeight - mEdgeLength * TILE_HEIGHT_ABSOLUTE) / 2};
-	mMapBoundingBox = {(size.x - TILE_WIDTH * mEdgeLength) / 2, mMapPosition.y, TILE_WIDTH * mEdgeLength, TILE_HEIGHT_ABSOLUTE * mEdgeLength};
+	mMapPosition = NAS2D::Point{(size.x - geometry.width) / 2, (size.y - constants::BottomUiHeight - mEdgeLength * geometry.heightAbsolute) / 2};
+	mMapBoundingBox = {(size.x - geometry.width * mEdgeLength) / 2, mMapPosition.y, geometry.width * mEdgeLength, geometry.heightAbsolute * mEdgeLength};
+
+	// Edge length may have grown past the map edge
+	mapViewLocation(mMapViewLocation);
+}
+
+
+/**
+ * Sets the zoom level, keeping the tile at the center of the view where
+ * it is.
+ *
+ * \note	Levels outside of the supported range are clamped.
+ */
+void TileMap::zoomLevel(int level)
+{
+	level = std::clamp(level, 0, MAX_ZOOM_LEVEL);
+	if (level == mZoomLevel) { return; }
+
+	const auto center = mMapViewLocation + NAS2D::Vector{mEdgeLength, mEdgeLength} / 2;
+	mZoomLevel = level;
+	initMapDrawParams(mViewportSize);
+	mapViewLocation(center - NAS2D::Vector{mEdgeLength, mEdgeLength} / 2);
+}
+
+
+const TileGeometry& TileMap::tileGeometry() const
+{
+	return TILE_GEOMETRY[static_cast<std::size_t>(mZoomLevel)];
 }
 
 
@@ -253,6 +432,7 @@ void TileMap::mapViewLocation(NAS2D::Point<int> point)
 		std::clamp(point.x, 0, mSizeInTiles.x - mEdgeLength),
 		std::clamp(point.y, 0, mSizeInTiles.y - mEdgeLength)
 	};
+	mDrawListDirty = true;
 }
 
 
@@ -279,44 +459,175 @@ bool TileMap::tileHighlightVisible() const
 }
 
 
+/**
+ * Builds the list of tiles that land in the map's bounding box for the
+ * current view location, depth and draw parameters so draw() doesn't have
+ * to look up tiles or compute screen positions every frame.
+ */
+void TileMap::buildDrawList()
+{
+	mDrawList.clear();
+
+	// Corners of the bounding box show tiles up to half an edge length outside the view
+	const int margin = mEdgeLength / 2 + 1;
+	const auto& box = mMapBoundingBox;
+
+	for (int row = -margin; row < mEdgeLength + margin; row++)
+	{
+		for (int col = -margin; col < mEdgeLength + margin; col++)
+		{
+			const auto mapPosition = mMapViewLocation + NAS2D::Vector{col, row};
+			if (!isValidPosition(mapPosition, mCurrentDepth)) { continue; }
+
+			const auto position = mMapPosition + NAS2D::Vector{(col - row) * TILE_HALF_WIDTH, (col + row) * TILE_HEIGHT_HALF_ABSOLUTE};
+			const bool inBox = position.x < box.x + box.width && position.x + TILE_WIDTH > box.x &&
+				position.y < box.y + box.height && position.y + TILE_HEIGHT > box.y;
+			if (!inBox) { continue; }
+
+			mDrawList.push_back({&getTile(mapPosition, mCurrentDepth), position});
+		}
+	}
+
+	mDrawListDirty = false;
+}
+
+
+/**
+ * Draws the visible portion of the map.
+ */
 void TileMap::draw()
+{
+	mAnimating = false;
+	drawChunks();
+	if (mZoomLevel == 0) { drawThings(); }
+
+	updateTileHighlight();
+}
+
+
+/**
+ * Draws mine beacons and things over full size terrain.
+ *
+ * Beacons and things reach above their tile so they're drawn in draw list
+ * order to overlap correctly. They're clipped to the sides and bottom of
+ * the map's bounding box like the terrain under them but may reach above
+ * it.
+ */
+void TileMap::drawThings()
 {
 	auto& renderer = Utility<Renderer>::get();
 
-	int tsetOffset = mCurrentDepth > 0 ? TILE_HEIGHT : 0;
-	const auto highlightOffset = mMapHighlight - mMapViewLocation;
+	if (mDrawListDirty) { buildDrawList(); }
+
+	const auto& box = mMapBoundingBox;
+	renderer.clipRect(NAS2D::Rectangle{box.x, 0, box.width, box.y + box.height}.to<float>());
 
-	for (int row = 0; row < mEdgeLength; row++)
+	const auto glow = static_cast<uint8_t>(120 + sin(mTimer.tick() / THROB_SPEED) * 57);
+	for (const auto& [tile, position] : mDrawList)
 	{
-		for (int col = 0; col < mEdgeLength; col++)
+		if (!tile->excavated()) { continue; }
+
+		if (tile->thing())
 		{
-			auto& tile = getTile(mMapViewLocation + NAS2D::Vector{col, row}, mCurrentDepth);
+			// Tell occupying things to update themselves.
+			tile->thing()->sprite().update(position);
+			mAnimating = mAnimating || tile->thing()->animating();
+		}
+		else if (tile->mine())
+		{
+			// Draw a beacon on an unoccupied tile with a mine
+			renderer.drawImage(*mMineBeacon, position + NAS2D::Vector{0, -64});
+			renderer.drawSubImage(*mMineBeacon, position + NAS2D::Vector{59, 15}, NAS2D::Rectangle{59, 79, 10, 7}, NAS2D::Color{glow, glow, glow});
+			mAnimating = true;
+		}
+	}
 
-			if (tile.excavated())
-			{
-				const auto position = mMapPosition + NAS2D::Vector{(col - row) * TILE_HALF_WIDTH, (col + row) * TILE_HEIGHT_HALF_ABSOLUTE};
-				const auto subImageRect = NAS2D::Rectangle{static_cast<int>(tile.index()) * TILE_WIDTH, tsetOffset, TILE_WIDTH, TILE_HEIGHT};
-				const bool isTileHighlighted = NAS2D::Vector{col, row} == highlightOffset;
+	renderer.clipRectClear();
+}
 
-				renderer.drawSubImage(mTileset, position, subImageRect, overlayColor(tile.overlay(), isTileHighlighted));
 
-				// Draw a beacon on an unoccupied tile with a mine
-				if (tile.mine() != nullptr && !tile.thing())
-				{
-					uint8_t glow = static_cast<uint8_t>(120 + sin(mTimer.tick() / THROB_SPEED) * 57);
-					const auto mineBeaconPosition = position + NAS2D::Vector{ 0, -64 };
+/**
+ * Draws the map's terrain from pre-rendered chunks.
+ *
+ * Chunks are drawn for every tile that lands in the map's bounding box,
+ * not only the visible diamond, so the map fills the screen. The number of
+ * draw calls depends on the zoom level and never exceeds the number of
+ * chunks in the map however large the viewport is. Chunks are rebuilt when
+ * TileMap's revision of their tiles changes, so a change to a tile only
+ * redraws the chunks around it.
+ *
+ * The highlighted tile is drawn over its chunk from the tileset's top
+ * faces so it doesn't cover the tiles in front of it.
+ */
+void TileMap::drawChunks()
+{
+	auto& renderer = Utility<Renderer>::get();
+	const auto& geometry = tileGeometry();
 
-					renderer.drawImage(mMineBeacon, mineBeaconPosition);
-					renderer.drawSubImage(mMineBeacon, position + NAS2D::Vector{ 59, 15 }, NAS2D::Rectangle{ 59, 79, 10, 7 }, NAS2D::Color{ glow, glow, glow });
-				}
+	const auto cacheIndex = static_cast<std::size_t>(mZoomLevel);
+	if (mChunkCaches.size() <= cacheIndex) { mChunkCaches.resize(cacheIndex + 1); }
+	auto& cache = mChunkCaches[cacheIndex];
+	if (!cache)
+	{
+		// Things are drawn over full size terrain, zoomed out maps mark where they are instead
+		const bool fullSize = mZoomLevel == 0;
+		const int edgeLength = fullSize ? FULL_SIZE_CHUNK_EDGE_LENGTH : MapChunkCache::ChunkEdgeLength;
+		const auto layer = fullSize ? MapChunkCache::Layer::Terrain : MapChunkCache::Layer::TerrainAndMarkers;
+		cache = std::make_unique<MapChunkCache>(*mTileset, geometry, 1 << mZoomLevel, edgeLength, layer);
+	}
 
-				// Tell an occupying thing to update itself.
-				if (tile.thing()) { tile.thing()->sprite().update(position); }
-			}
+	const auto screenPosition = [this, &geometry](NAS2D::Point<int> mapPosition)
+	{
+		const auto offset = mapPosition - mMapViewLocation;
+		return mMapPosition + NAS2D::Vector{(offset.x - offset.y) * geometry.halfWidth, (offset.x + offset.y) * geometry.halfHeightAbsolute};
+	};
+
+	// Corners of the bounding box show tiles up to half an edge length outside the view
+	const int chunkEdgeLength = cache->edgeLength();
+	const int margin = mEdgeLength / 2 + 1;
+	const auto firstChunk = NAS2D::Point{
+		std::max(0, mMapViewLocation.x - margin) / chunkEdgeLength,
+		std::max(0, mMapViewLocation.y - margin) / chunkEdgeLength
+	};
+	const auto lastChunk = NAS2D::Point{
+		std::min(mSizeInTiles.x - 1, mMapViewLocation.x + mEdgeLength + margin) / chunkEdgeLength,
+		std::min(mSizeInTiles.y - 1, mMapViewLocation.y + mEdgeLength + margin) / chunkEdgeLength
+	};
+
+	// Room for the chunks in view plus as many again so panning back and forth doesn't rebuild them
+	const auto chunksInView = static_cast<std::size_t>((lastChunk.x - firstChunk.x + 1) * (lastChunk.y - firstChunk.y + 1));
+	cache->capacity(chunksInView * 2);
+
+	const auto chunkSize = cache->chunkSize();
+	const auto& box = mMapBoundingBox;
+
+	renderer.clipRect(box.to<float>());
+
+	for (int y = firstChunk.y; y <= lastChunk.y; ++y)
+	{
+		for (int x = firstChunk.x; x <= lastChunk.x; ++x)
+		{
+			const auto position = screenPosition({x * chunkEdgeLength, y * chunkEdgeLength}) + cache->chunkOffset();
+			const bool onScreen = position.x < box.x + box.width && position.x + chunkSize.x > box.x &&
+				position.y < box.y + box.height && position.y + chunkSize.y > box.y;
+			if (!onScreen) { continue; }
+
+			renderer.drawImage(cache->chunk(*this, {x, y}, mCurrentDepth), position);
 		}
 	}
 
-	updateTileHighlight();
+	if (tileHighlightVisible())
+	{
+		auto& tile = getTile(mMapHighlight, mCurrentDepth);
+		if (tile.excavated())
+		{
+			const int tsetOffset = mCurrentDepth > 0 ? geometry.height : 0;
+			const auto subImageRect = NAS2D::Rectangle{static_cast<int>(tile.index()) * geometry.width, tsetOffset, geometry.width, geometry.height};
+			renderer.drawSubImage(cache->tileTops(), screenPosition(mMapHighlight), subImageRect, overlayHighlightColor(tile.overlay()));
+		}
+	}
+
+	renderer.clipRectClear();
 }
 
 
@@ -330,17 +641,23 @@ void TileMap::updateTileHighlight()
 		return;
 	}
 
+	const auto& geometry = tileGeometry();
+
 	/// In the case of even edge lengths, we need to adjust the mouse picking code a bit.
-	const int evenEdgeLengthAdjust = (edgeLength() % 2 == 0) ? TILE_HALF_WIDTH : 0;
-	const int offsetX = ((mMousePosition.x - mMapBoundingBox.x - evenEdgeLengthAdjust) / TILE_WIDTH);
-	const int offsetY = ((mMousePosition.y - mMapBoundingBox.y) / TILE_HEIGHT_ABSOLUTE);
-	const int transform = (mMapPosition.x - mMapBoundingBox.x) / TILE_WIDTH;
+	const int evenEdgeLengthAdjust = (edgeLength() % 2 == 0) ? geometry.halfWidth : 0;
+	const int offsetX = ((mMousePosition.x - mMapBoundingBox.x - evenEdgeLengthAdjust) / geometry.width);
+	const int offsetY = ((mMousePosition.y - mMapBoundingBox.y) / geometry.heightAbsolute);
+	const int transform = (mMapPosition.x - mMapBoundingBox.x) / geometry.width;
 	NAS2D::Vector<int> highlightOffset = {-transform + offsetY + offsetX, transform + offsetY - offsetX};
 
-	const int mmOffsetX = std::clamp((mMousePosition.x - mMapBoundingBox.x - evenEdgeLengthAdjust) % TILE_WIDTH, 0, TILE_WIDTH);
-	const int mmOffsetY = (mMousePosition.y - mMapBoundingBox.y) % TILE_HEIGHT_ABSOLUTE;
+	const int mmOffsetX = std::clamp((mMousePosition.x - mMapBoundingBox.x - evenEdgeLengthAdjust) % geometry.width, 0, geometry.width);
+	const int mmOffsetY = (mMousePosition.y - mMapBoundingBox.y) % geometry.heightAbsolute;
 
-	switch (getMouseMapRegion(mmOffsetX, mmOffsetY))
+	// The mouse map is full tile size so scale offsets on zoomed out maps up to match
+	const int mouseMapX = std::min(mmOffsetX * TILE_WIDTH / geometry.width, TILE_WIDTH - 1);
+	const int mouseMapY = std::min(mmOffsetY * TILE_HEIGHT_ABSOLUTE / geometry.heightAbsolute, TILE_HEIGHT_ABSOLUTE - 1);
+
+	switch (getMouseMapRegion(mouseMapX, mouseMapY))
 	{
 	case MouseMapRegion::MMR_TOP_RIGHT:
 		--highlightOffset.y;
@@ -412,7 +729,7 @@ void TileMap::serialize(NAS2D::Xml::XmlElement* element)
 	auto* mines = new NAS2D::Xml::XmlElement("mines");
 	element->linkEndChild(mines);
 
-	for (const auto& location : mMineLocations)
+	for (const auto& location : mMineLocations.locations())
 	{
 		auto& mine = *getTile(location, TileMapLevel::LEVEL_SURFACE).mine();
 		mines->linkEndChild(mine.serialize(location));
@@ -429,6 +746,16 @@ void TileMap::serialize(NAS2D::Xml::XmlElement* element)
 	// underground and excavated or surface and bulldozed.
 	for (int depth = 0; depth <= maxDepth(); ++depth)
 	{
+		// Levels that were never loaded can only contain what was read from the save file.
+		if (!isLevelLoaded(depth))
+		{
+			for (const auto& [position, index] : mPendingTiles[static_cast<std::size_t>(depth)])
+			{
+				tiles->linkEndChild(serializeTile(position.x, position.y, depth, index));
+			}
+			continue;
+		}
+
 		for (int y = 0; y < mSizeInTiles.y; ++y)
 		{
 			for (int x = 0; x < mSizeInTiles.x; ++x)
@@ -474,7 +801,7 @@ void TileMap::deserialize(NAS2D::Xml::XmlElement* element)
 		tile.pushMine(mine);
 		tile.index(TerrainType::Dozed);
 
-		mMineLocations.push_back(Point{x, y});
+		mMineLocations.add(Point{x, y});
 
 		/// \fixme	Legacy code to assist in updating older versions of save games between 0.7.5 and 0.7.6. Remove in 0.8.0
 		if (mine->depth() == 0 && mine->active()) { mine->increaseDepth(); }
@@ -490,6 +817,13 @@ void TileMap::deserialize(NAS2D::Xml::XmlElement* element)
 		const auto depth = tileDictionary.get<int>("depth");
 		const auto index = tileDictionary.get<int>("index");
 
+		// Defer tiles on levels that haven't been loaded yet, they're applied when the level is first accessed.
+		if (isValidPosition({x, y}, depth) && !isLevelLoaded(depth))
+		{
+			mPendingTiles[static_cast<std::size_t>(depth)].push_back({{x, y}, static_cast<TerrainType>(index)});
+			continue;
+		}
+
 		auto& tile = getTile({x, y}, depth);
 		tile.index(static_cast<TerrainType>(index));
 
@@ -509,6 +843,19 @@ Tile* TileMap::getVisibleTile(NAS2D::Point<int> position, int level)
 }
 
 
+/**
+ * Gets a counter that changes whenever any tile in a block of
+ * MapChunkCache::ChunkEdgeLength x MapChunkCache::ChunkEdgeLength tiles
+ * changes how it looks.
+ *
+ * \param	chunkPosition	Position of the block in blocks, not tiles.
+ */
+std::uint32_t TileMap::chunkRevision(NAS2D::Point<int> chunkPosition, int level) const
+{
+	return mChunkRevisions[static_cast<std::size_t>(level)][static_cast<std::size_t>(chunkPosition.y * mChunksPerRow + chunkPosition.x)];
+}
+
+
 bool TileMap::isVisibleTile(NAS2D::Point<int> position, int z) const
 {
 	if (!NAS2D::Rectangle{mMapViewLocation.x, mMapViewLocation.y, mEdgeLength, mEdgeLength}.contains(position))
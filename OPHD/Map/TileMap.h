@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Tile.h"
+#include "MapChunkCache.h"
+#include "MineLocationIndex.h"
 
 #include "../States/Planet.h"
 #include "../MicroPather/micropather.h"
@@ -9,6 +11,8 @@
 #include <NAS2D/Renderer/Vector.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 
 
 namespace NAS2D {
@@ -34,17 +38,19 @@ public:
 	};
 
 
-	TileMap(const std::string& mapPath, const std::string& tilesetPath, int maxDepth, int mineCount, Planet::Hostility hostility /*= constants::Hostility::None*/, bool setupMines = true);
+	TileMap(const std::string& mapPath, const std::string& tilesetPath, int maxDepth, int mineCount, int mineSpacing, Planet::Hostility hostility /*= constants::Hostility::None*/, bool setupMines = true);
 	TileMap(const TileMap&) = delete;
 	TileMap& operator=(const TileMap&) = delete;
 
 	bool isValidPosition(NAS2D::Point<int> position, int level = 0) const;
+	bool isLevelLoaded(int level) const;
 
 	Tile& getTile(NAS2D::Point<int> position, int level);
 	Tile& getTile(NAS2D::Point<int> position) { return getTile(position, mCurrentDepth); }
 
 	Tile* getVisibleTile(NAS2D::Point<int> position, int level);
 	Tile* getVisibleTile() { return getVisibleTile(tileMouseHover(), mCurrentDepth); }
+	std::uint32_t chunkRevision(NAS2D::Point<int> chunkPosition, int level) const;
 
 	bool isVisibleTile(NAS2D::Point<int> position, int z) const;
 	bool isVisibleTile(NAS2D::Point<int> position) const { return isVisibleTile(position, mCurrentDepth); }
@@ -59,22 +65,26 @@ public:
 	bool tileHighlightVisible() const;
 	NAS2D::Point<int> tileMouseHover() const { return mMapHighlight; }
 
-	const Point2dList& mineLocations() const { return mMineLocations; }
+	const Point2dList& mineLocations() const { return mMineLocations.locations(); }
 	void removeMineLocation(const NAS2D::Point<int>& pt);
 
 	int edgeLength() const { return mEdgeLength; }
 	NAS2D::Vector<int> size() const { return mSizeInTiles; }
 
 	int currentDepth() const { return mCurrentDepth; }
-	void currentDepth(int i) { mCurrentDepth = std::clamp(i, 0, mMaxDepth); }
+	void currentDepth(int i) { mCurrentDepth = std::clamp(i, 0, mMaxDepth); mDrawListDirty = true; }
 
 	int maxDepth() const { return mMaxDepth; }
 
+	int zoomLevel() const { return mZoomLevel; }
+	void zoomLevel(int level);
+
 	void injectMouse(NAS2D::Point<int> position) { mMousePosition = position; }
 
 	void initMapDrawParams(NAS2D::Vector<int>);
 
 	void draw();
+	bool animating() const { return mAnimating; }
 
 	void serialize(NAS2D::Xml::XmlElement* element);
 	void deserialize(NAS2D::Xml::XmlElement* element);
@@ -102,13 +112,26 @@ protected:
 private:
 	using TileGrid = std::vector<std::vector<Tile> >;
 	using TileArray = std::vector<TileGrid>;
+	using TileRecordList = std::vector<std::pair<NAS2D::Point<int>, TerrainType>>;
+
+	/** A visible tile and where it's drawn on screen. */
+	struct TileDrawEntry
+	{
+		Tile* tile;
+		NAS2D::Point<int> position;
+	};
 
 	void buildMouseMap();
 	void buildTerrainMap(const std::string& path);
-	void setupMines(int, Planet::Hostility);
-	void addMineSet(NAS2D::Point<int> suggestedMineLocation, Point2dList& plist, MineProductionRate rate);
-	NAS2D::Point<int> findSurroundingMineLocation(NAS2D::Point<int> centerPoint);
+	void loadLevel(int level);
+	void setupMines(int mineCount, int mineSpacing, Planet::Hostility);
+	void placeMine(NAS2D::Point<int> location, MineProductionRate rate);
 
+	const TileGeometry& tileGeometry() const;
+
+	void buildDrawList();
+	void drawChunks();
+	void drawThings();
 	void updateTileHighlight();
 
 	MouseMapRegion getMouseMapRegion(int x, int y);
@@ -117,6 +140,9 @@ private:
 	int mEdgeLength = 0;
 	const NAS2D::Vector<int> mSizeInTiles;
 
+	int mZoomLevel = 0; /**< 0 draws full size tiles, higher levels draw smaller tiles with markers in place of things. */
+	NAS2D::Vector<int> mViewportSize;
+
 	int mMaxDepth = 0; /**< Maximum digging depth. */
 	int mCurrentDepth = 0; /**< Current depth level to view. */
 
@@ -125,10 +151,14 @@ private:
 	std::string mMapPath;
 	std::string mTsetPath;
 
-	TileArray mTileMap;
+	TileArray mTileMap; /**< Tile levels. Underground levels are left empty until first accessed. */
+	std::vector<TerrainType> mTerrain; /**< Terrain indices decoded from the height map, row-major. */
+	std::vector<TileRecordList> mPendingTiles; /**< Saved tile records for levels that haven't been loaded yet. */
+	std::vector<std::vector<std::uint32_t>> mChunkRevisions; /**< Per level, revision counters for each block of MapChunkCache::ChunkEdgeLength tiles, shared by the block's tiles. */
+	int mChunksPerRow = 0;
 
-	const NAS2D::Image mTileset;
-	const NAS2D::Image mMineBeacon;
+	std::unique_ptr<const NAS2D::Image> mTileset;
+	std::unique_ptr<const NAS2D::Image> mMineBeacon;
 
 	NAS2D::Timer mTimer;
 
@@ -138,7 +168,13 @@ private:
 
 	NAS2D::Point<int> mMapPosition; /** Where to start drawing the TileMap on the screen. */
 
-	Point2dList mMineLocations; /**< Location of all mines on the map. */
+	MineLocationIndex mMineLocations; /**< Location of all mines on the map. */
 
 	NAS2D::Rectangle<int> mMapBoundingBox; /** Area that the TileMap fills when drawn. */
+
+	std::vector<TileDrawEntry> mDrawList; /**< Tiles in the bounding box in draw order, for drawing things. Rebuilt when the view changes. */
+	bool mDrawListDirty = true;
+	bool mAnimating = false; /**< A beacon or animated sprite was drawn in the last frame. */
+
+	std::vector<std::unique_ptr<MapChunkCache>> mChunkCaches; /**< One per zoom level, built on first use. */
 };
@@ -27,20 +27,6 @@ static const std::map<MineProductionRate, std::array<int, 4>> YieldTable =
 };
 
 
-/**
- * Helper function that gets the total amount of ore 
- */
-static int getOreCount(const Mine::MineVeins& veins, Mine::OreType ore, int depth)
-{
-	int value = 0;
-	for (std::size_t i = 0; i < static_cast<std::size_t>(depth); ++i)
-	{
-		value += veins[i][ore];
-	}
-	return value;
-}
-
-
 static void setDefaultFlags(std::bitset<6>& flags)
 {
 	flags[Mine::OreType::ORE_COMMON_METALS] = true;
@@ -74,6 +60,7 @@ bool Mine::active() const
 void Mine::active(bool newActive)
 {
 	mFlags[4] = newActive;
+	updateExhausted();
 }
 
 
@@ -133,7 +120,15 @@ void Mine::miningRareMinerals(bool value)
  */
 void Mine::increaseDepth()
 {
-	mVeins.push_back(YieldTable.at(productionRate()));
+	const auto& vein = YieldTable.at(productionRate());
+	mVeins.push_back(vein);
+
+	for (std::size_t i = 0; i < mOreAvailable.size(); ++i)
+	{
+		mOreAvailable[i] += vein[i];
+	}
+
+	updateExhausted();
 }
 
 
@@ -152,7 +147,7 @@ int Mine::depth() const
  */
 int Mine::commonMetalsAvailable() const
 {
-	return getOreCount(mVeins, OreType::ORE_COMMON_METALS, depth());
+	return mOreAvailable[OreType::ORE_COMMON_METALS];
 }
 
 
@@ -162,7 +157,7 @@ int Mine::commonMetalsAvailable() const
  */
 int Mine::commonMineralsAvailable() const
 {
-	return getOreCount(mVeins, OreType::ORE_COMMON_MINERALS, depth());
+	return mOreAvailable[OreType::ORE_COMMON_MINERALS];
 }
 
 
@@ -172,7 +167,7 @@ int Mine::commonMineralsAvailable() const
  */
 int Mine::rareMetalsAvailable() const
 {
-	return getOreCount(mVeins, OreType::ORE_RARE_METALS, depth());
+	return mOreAvailable[OreType::ORE_RARE_METALS];
 }
 
 
@@ -182,7 +177,7 @@ int Mine::rareMetalsAvailable() const
  */
 int Mine::rareMineralsAvailable() const
 {
-	return getOreCount(mVeins, OreType::ORE_RARE_MINERALS, depth());
+	return mOreAvailable[OreType::ORE_RARE_MINERALS];
 }
 
 
@@ -200,7 +195,7 @@ int Mine::rareMineralsAvailable() const
  */
 int Mine::oreAvailable(size_t index) const
 {
-	return getOreCount(mVeins, static_cast<Mine::OreType>(index), depth());
+	return mOreAvailable.at(index);
 }
 
 
@@ -232,27 +227,22 @@ bool Mine::exhausted() const
 
 
 /**
- * Checks if the mine is exhausted and if it is sets the exhausted flag.
- * 
- * \note	This function is provided so that this computation is only
- *			done once per turn instead of being done every frame. The
- *			issue came up after updating the minimap code to indicate
- *			exhausted mines.
+ * Sets the exhausted flag if an active mine has no ore left, or clears it if
+ * digging deeper has turned up more.
+ *
+ * Fires the oreExhausted() signal when the mine becomes exhausted.
  */
-void Mine::checkExhausted()
+void Mine::updateExhausted()
 {
 	if (!active()) { return; }
 
-	int ore_count = 0;
-	for (auto vein : mVeins)
+	const bool wasExhausted = exhausted();
+	mFlags[5] = (mOreAvailable == MineVein{0, 0, 0, 0});
+
+	if (exhausted() && !wasExhausted)
 	{
-		ore_count += vein[OreType::ORE_COMMON_METALS];
-		ore_count += vein[OreType::ORE_COMMON_MINERALS];
-		ore_count += vein[OreType::ORE_RARE_METALS];
-		ore_count += vein[OreType::ORE_RARE_MINERALS];
+		mOreExhausted(this);
 	}
-
-	mFlags[5] = (ore_count == 0);
 }
 
 
@@ -262,18 +252,50 @@ void Mine::checkExhausted()
  */
 int Mine::pull(OreType type, int quantity)
 {
-	int pullCount = 0;
+	MineVein quantities{0, 0, 0, 0};
+	quantities[type] = quantity;
+	return pull(quantities)[type];
+}
+
+
+/**
+ * Pulls ore of every type from the Mine in a single pass over its veins.
+ * If insufficient ore of a type is available, only pulls what's available.
+ *
+ * \param	quantities	Amount of each type of ore to pull, indexed by OreType.
+ *
+ * \return	Amount of each type of ore actually pulled.
+ */
+Mine::MineVein Mine::pull(const MineVein& quantities)
+{
+	MineVein remaining;
+	for (std::size_t i = 0; i < remaining.size(); ++i)
+	{
+		remaining[i] = std::clamp(quantities[i], 0, mOreAvailable[i]);
+	}
+
+	const auto pulled = remaining;
 
 	for (auto& vein : mVeins)
 	{
-		const auto transferAmount = std::min(vein[type], quantity - pullCount);
-		pullCount += transferAmount;
-		vein[type] -= transferAmount;
+		if (remaining == MineVein{0, 0, 0, 0}) { break; }
+
+		for (std::size_t i = 0; i < vein.size(); ++i)
+		{
+			const auto transferAmount = std::min(vein[i], remaining[i]);
+			vein[i] -= transferAmount;
+			remaining[i] -= transferAmount;
+		}
+	}
 
-		if (pullCount == quantity) { break; }
+	for (std::size_t i = 0; i < mOreAvailable.size(); ++i)
+	{
+		mOreAvailable[i] -= pulled[i];
 	}
 
-	return pullCount;
+	updateExhausted();
+
+	return pulled;
 }
 
 
@@ -323,11 +345,12 @@ void Mine::deserialize(NAS2D::Xml::XmlElement* element)
 	const auto yield = dictionary.get<int>("yield");
 	mFlags = std::bitset<6>(dictionary.get("flags"));
 
-	this->active(active);
+	mFlags[4] = active;
 	mProductionRate = static_cast<MineProductionRate>(yield);
 
 	mVeins.resize(0);
 	mVeins.reserve(static_cast<std::size_t>(depth));
+	mOreAvailable = {0, 0, 0, 0};
 	for (auto* vein = element->firstChildElement(); vein != nullptr; vein = vein->nextSiblingElement())
 	{
 		const auto veinDictionary = NAS2D::attributesToDictionary(*vein);
@@ -339,5 +362,13 @@ void Mine::deserialize(NAS2D::Xml::XmlElement* element)
 		mineVein[OreType::ORE_RARE_MINERALS] = veinDictionary.get<int>("rare_minerals");
 
 		mVeins.push_back(mineVein);
+
+		for (std::size_t i = 0; i < mOreAvailable.size(); ++i)
+		{
+			mOreAvailable[i] += mineVein[i];
+		}
 	}
+
+	// Loading isn't news so the exhausted flag is set without firing oreExhausted()
+	if (this->active()) { mFlags[5] = (mOreAvailable == MineVein{0, 0, 0, 0}); }
 }
@@ -4,10 +4,18 @@
 #include "Constants.h"
 
 #include <NAS2D/Renderer/Point.h>
+#include <NAS2D/Signal/Signal.h>
 #include <NAS2D/Xml/XmlElement.h>
 
 #include <bitset>
 
+/**
+ * Ore deposit at a mine location.
+ *
+ * Keeps a running total of the ore left in all of its veins so queries
+ * don't have to add them up. The totals and the exhausted flag are updated
+ * as ore is pulled and the mine is dug deeper.
+ */
 class Mine
 {
 public:
@@ -22,6 +30,8 @@ public:
 	using MineVein = std::array<int, 4>;
 	using MineVeins = std::vector<MineVein>;
 
+	using ExhaustedSignal = NAS2D::Signal<Mine*>;
+
 public:
 	Mine();
 	Mine(MineProductionRate rate);
@@ -30,7 +40,7 @@ public:
 	void active(bool newActive);
 
 	bool exhausted() const;
-	void checkExhausted();
+	ExhaustedSignal::Source& oreExhausted() { return mOreExhausted; }
 
 	MineProductionRate productionRate() const { return mProductionRate; }
 
@@ -56,6 +66,7 @@ public:
 	void miningRareMinerals(bool value);
 
 	int pull(OreType type, int quantity);
+	MineVein pull(const MineVein& quantities);
 
 public:
 	NAS2D::Xml::XmlElement* serialize(NAS2D::Point<int> location);
@@ -65,8 +76,12 @@ private:
 	Mine(const Mine&) = delete;
 	Mine& operator=(const Mine&) = delete;
 
+private:
+	void updateExhausted();
+
 private:
 	MineVeins mVeins; /**< Ore veins */
+	MineVein mOreAvailable{0, 0, 0, 0}; /**< Total ore left in all veins. */
 	MineProductionRate mProductionRate = MineProductionRate::Low; /**< Mine's production rate. */
 
 	/**
@@ -80,4 +95,6 @@ private:
 	 * [5] : Mine is exhausted
 	 */
 	std::bitset<6> mFlags; /**< Set of flags. */
+
+	ExhaustedSignal mOreExhausted; /**< Called when the last of the ore in an active mine is pulled. */
 };
@@ -0,0 +1,107 @@
+#include "ObjectPool.h"
+
+#include <algorithm>
+
+
+namespace
+{
+	const std::size_t BlocksPerChunk = 32;
+
+
+	struct BlockHeader
+	{
+		ObjectPool* pool = nullptr;
+		std::uint32_t generation = 0;
+	};
+
+
+	std::size_t alignUp(std::size_t size)
+	{
+		const std::size_t alignment = alignof(std::max_align_t);
+		return (size + alignment - 1) / alignment * alignment;
+	}
+
+
+	// Header is padded so the object after it is aligned for any type
+	const std::size_t HeaderSize = alignUp(sizeof(BlockHeader));
+
+
+	BlockHeader& header(const void* pointer)
+	{
+		return *reinterpret_cast<BlockHeader*>(const_cast<std::byte*>(static_cast<const std::byte*>(pointer)) - HeaderSize);
+	}
+}
+
+
+/**
+ * \param	objectSize	Size of the objects the pool holds.
+ */
+ObjectPool::ObjectPool(std::size_t objectSize) :
+	mBlockSize{HeaderSize + alignUp(std::max(objectSize, sizeof(FreeBlock)))}
+{}
+
+
+/**
+ * Gets a block for one object.
+ */
+void* ObjectPool::allocate()
+{
+	if (!mFreeList) { grow(); }
+
+	auto* block = mFreeList;
+	mFreeList = block->next;
+	return block;
+}
+
+
+/**
+ * Returns a block to the pool.
+ *
+ * \param	pointer	Pointer returned by allocate() on this pool.
+ */
+void ObjectPool::deallocate(void* pointer) noexcept
+{
+	if (!pointer) { return; }
+
+	++header(pointer).generation;
+	mFreeList = new (pointer) FreeBlock{mFreeList};
+}
+
+
+/**
+ * Gets the pool a block was allocated from.
+ *
+ * \param	pointer	Pointer returned by allocate().
+ */
+ObjectPool& ObjectPool::owner(const void* pointer)
+{
+	return *header(pointer).pool;
+}
+
+
+/**
+ * Gets the generation of the block an object was allocated in. Changes
+ * every time the block is freed.
+ *
+ * \param	pointer	Pointer returned by allocate(). Safe to use after the
+ *					block has been freed.
+ */
+std::uint32_t ObjectPool::generation(const void* pointer)
+{
+	return header(pointer).generation;
+}
+
+
+void ObjectPool::grow()
+{
+	mChunks.push_back(std::make_unique<std::byte[]>(mBlockSize * BlocksPerChunk));
+	auto* chunk = mChunks.back().get();
+
+	// Pushed in reverse so blocks are handed out in address order
+	for (std::size_t i = BlocksPerChunk; i-- > 0;)
+	{
+		auto* block = chunk + i * mBlockSize;
+		new (block) BlockHeader{this, 0};
+		mFreeList = new (block + HeaderSize) FreeBlock{mFreeList};
+	}
+}
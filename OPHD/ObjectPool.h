@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+/**
+ * Block allocator for objects of a single type that are created and
+ * destroyed throughout a game, like Structures.
+ *
+ * Blocks are allocated in chunks and reused through a free list instead
+ * of going back to the heap. Every block starts with a small header that
+ * records the pool it belongs to and a generation that is bumped when
+ * it's freed, so a block can be freed without knowing its type and a
+ * PoolHandle can tell a live object from whatever was built in its place.
+ *
+ * Pools are reached through TypedPool<T>, one per concrete type.
+ *
+ * \note	Memory is never handed back to the system. Pools only grow to
+ *			the largest number of objects alive at once.
+ */
+class ObjectPool
+{
+public:
+	explicit ObjectPool(std::size_t objectSize);
+	ObjectPool(const ObjectPool&) = delete;
+	ObjectPool& operator=(const ObjectPool&) = delete;
+
+	void* allocate();
+	void deallocate(void* pointer) noexcept;
+
+	static ObjectPool& owner(const void* pointer);
+	static std::uint32_t generation(const void* pointer);
+
+private:
+	struct FreeBlock
+	{
+		FreeBlock* next = nullptr;
+	};
+
+	void grow();
+
+	std::size_t mBlockSize;
+	std::vector<std::unique_ptr<std::byte[]>> mChunks;
+	FreeBlock* mFreeList = nullptr;
+};
+
+
+/**
+ * Pool holding only objects of type \c T so objects of the same type
+ * sit next to each other in memory.
+ *
+ * Objects are built with create() and destroyed with a plain delete,
+ * which the type routes back to ObjectPool::owner() from its class
+ * operator delete.
+ */
+template <class T>
+class TypedPool
+{
+public:
+	static_assert(alignof(T) <= alignof(std::max_align_t), "TypedPool can't align over-aligned types.");
+
+	template <typename... Args>
+	static T* create(Args&&... args)
+	{
+		auto& objectPool = pool();
+		void* block = objectPool.allocate();
+		try
+		{
+			return ::new (block) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			objectPool.deallocate(block);
+			throw;
+		}
+	}
+
+	static ObjectPool& pool()
+	{
+		// Never destroyed so objects still alive at exit can be freed into it
+		static auto* objectPool = new ObjectPool{sizeof(T)};
+		return *objectPool;
+	}
+};
+
+
+/**
+ * Reference to an object allocated from ObjectPool that knows when the
+ * object it refers to has been destroyed.
+ */
+template <class T>
+class PoolHandle
+{
+public:
+	PoolHandle() = default;
+
+	explicit PoolHandle(T* object) :
+		mObject{object},
+		mBlock{object ? dynamic_cast<const void*>(object) : nullptr},
+		mGeneration{mBlock ? ObjectPool::generation(mBlock) : 0}
+	{}
+
+	/**
+	 * Gets the object the handle refers to.
+	 *
+	 * \return	Returns nullptr if the object has been destroyed.
+	 */
+	T* get() const
+	{
+		if (!mBlock || ObjectPool::generation(mBlock) != mGeneration) { return nullptr; }
+		return mObject;
+	}
+
+	bool operator==(const PoolHandle& other) const { return mObject == other.mObject && mGeneration == other.mGeneration; }
+	bool operator!=(const PoolHandle& other) const { return !(*this == other); }
+
+	bool operator<(const PoolHandle& other) const
+	{
+		if (mObject != other.mObject) { return std::less<T*>{}(mObject, other.mObject); }
+		return mGeneration < other.mGeneration;
+	}
+
+private:
+	T* mObject = nullptr;
+	const void* mBlock = nullptr; /**< Start of the most derived object, where ObjectPool keeps its header. */
+	std::uint32_t mGeneration = 0;
+};
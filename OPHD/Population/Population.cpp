@@ -28,6 +28,44 @@ namespace {
 	{
 		return static_cast<std::size_t>(std::clamp(morale, 1, 999) / 200);
 	}
+
+
+	/**
+	 * Spreads deaths as evenly as possible across roles without taking more
+	 * from a role than it has. Roles that run out pass the rest of their
+	 * share on to the others and deaths that don't divide evenly go to the
+	 * youngest roles first.
+	 *
+	 * Each pass either empties a role or settles every remaining death, so
+	 * cost doesn't depend on how many colonists die.
+	 */
+	PopulationTable distributeDeaths(const PopulationTable& population, int deaths)
+	{
+		PopulationTable killed;
+		killed.clear();
+
+		while (deaths > 0)
+		{
+			int rolesLeft = 0;
+			for (std::size_t roleIndex = 0; roleIndex < 5; ++roleIndex)
+			{
+				if (population[roleIndex] > killed[roleIndex]) { ++rolesLeft; }
+			}
+
+			if (rolesLeft == 0) { break; }
+
+			// At least one death per role with anyone left so the remainder is settled
+			const int share = std::max(deaths / rolesLeft, 1);
+			for (std::size_t roleIndex = 0; roleIndex < 5 && deaths > 0; ++roleIndex)
+			{
+				const int taken = std::min({population[roleIndex] - killed[roleIndex], share, deaths});
+				killed[roleIndex] += taken;
+				deaths -= taken;
+			}
+		}
+
+		return killed;
+	}
 }
 
 
@@ -241,27 +279,10 @@ int Population::consumeFood(int food)
 	int populationToKill = static_cast<int>((mPopulation.size() - PopulationFed) * mStarveRate);
 	if (mPopulation.size() == 1) { populationToKill = 1; }
 
-	for (int i = 0; i < populationToKill; /**/ )
+	const auto starved = distributeDeaths(mPopulation, populationToKill);
+	for (std::size_t roleIndex = 0; roleIndex < 5; ++roleIndex)
 	{
-		std::size_t roleIndex = i % 5;
-
-		std::size_t counter = 0;
-		for (;;)
-		{
-			roleIndex = roleIndex + counter;
-			if (roleIndex > 4) { roleIndex = 0; }
-
-			if (mPopulation[roleIndex] > 0)
-			{
-				break;
-			}
-
-			++counter;
-			if (counter > 4) { counter = 0; }
-		}
-
-		--mPopulation[roleIndex];
-		++i;
+		mPopulation[roleIndex] -= starved[roleIndex];
 	}
 
 	mDeathCount = populationToKill;
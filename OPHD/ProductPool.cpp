@@ -1,5 +1,7 @@
 #include "ProductPool.h"
 
+#include "WarehouseIndex.h"
+
 #include <NAS2D/ParserHelper.h>
 
 #include <algorithm>
@@ -116,6 +118,30 @@ int storageRequiredPerUnit(ProductType type)
 }
 
 
+/**
+ * Copies the products and capacity of another pool. Copies aren't linked
+ * to a WarehouseIndex.
+ */
+ProductPool::ProductPool(const ProductPool& other) :
+	mProducts{other.mProducts},
+	mCapacity{other.mCapacity},
+	mCurrentStorageCount{other.mCurrentStorageCount}
+{}
+
+
+/**
+ * Copies the products and capacity of another pool. Keeps this pool's link
+ * to a WarehouseIndex.
+ */
+ProductPool& ProductPool::operator=(const ProductPool& other)
+{
+	mProducts = other.mProducts;
+	mCapacity = other.mCapacity;
+	storageChanged();
+	return *this;
+}
+
+
 int ProductPool::capacity() const
 {
 	return mCapacity;
@@ -186,7 +212,7 @@ void ProductPool::store(ProductType type, int count)
 		mProducts[static_cast<std::size_t>(type)] += count;
 	}
 
-	mCurrentStorageCount = computeCurrentStorage(mProducts);
+	storageChanged();
 }
 
 
@@ -194,7 +220,7 @@ int ProductPool::pull(ProductType type, int c)
 {
 	int pulledCount = std::clamp(c, 0, mProducts[static_cast<std::size_t>(type)]);
 	mProducts[static_cast<std::size_t>(type)] -= pulledCount;
-	mCurrentStorageCount = computeCurrentStorage(mProducts);
+	storageChanged();
 
 	return pulledCount;
 }
@@ -207,8 +233,26 @@ int ProductPool::count(ProductType type)
 
 
 void ProductPool::verifyCount()
+{
+	storageChanged();
+}
+
+
+/**
+ * Links the pool to a WarehouseIndex that's kept up to date with how much
+ * storage is available. Pass nullptr to unlink it.
+ */
+void ProductPool::index(WarehouseIndex* warehouseIndex, std::size_t slot)
+{
+	mIndex = warehouseIndex;
+	mIndexSlot = slot;
+}
+
+
+void ProductPool::storageChanged()
 {
 	mCurrentStorageCount = computeCurrentStorage(mProducts);
+	if (mIndex) { mIndex->update(mIndexSlot, availableStorage()); }
 }
 
 
@@ -241,5 +285,5 @@ void ProductPool::deserialize(const NAS2D::Dictionary& dictionary)
 	mProducts[ProductType::PRODUCT_CLOTHING] = dictionary.get<int>(constants::SaveGameProductClothing);
 	mProducts[ProductType::PRODUCT_MEDICINE] = dictionary.get<int>(constants::SaveGameProductMedicine);
 
-	mCurrentStorageCount = computeCurrentStorage(mProducts);
+	storageChanged();
 }
@@ -8,6 +8,8 @@
 #include <array>
 
 
+class WarehouseIndex;
+
 int storageRequiredPerUnit(ProductType type);
 
 class ProductPool
@@ -19,8 +21,8 @@ public:
 	ProductPool() = default;
 	~ProductPool() = default;
 
-	ProductPool(const ProductPool&) = default;
-	ProductPool& operator=(const ProductPool&) = default;
+	ProductPool(const ProductPool& other);
+	ProductPool& operator=(const ProductPool& other);
 
 	int capacity() const;
 
@@ -42,9 +44,18 @@ public:
 
 	void verifyCount();
 
+	void index(WarehouseIndex* warehouseIndex, std::size_t slot);
+	WarehouseIndex* index() const { return mIndex; }
+	std::size_t indexSlot() const { return mIndexSlot; }
+
 private:
+	void storageChanged();
+
 	ProductTypeCount mProducts = {{ 0 }};
 
 	int mCapacity = constants::BaseProductCapacity;
 	int mCurrentStorageCount = 0;
+
+	WarehouseIndex* mIndex = nullptr; /**< Index told about changes to available storage. Not copied. */
+	std::size_t mIndexSlot = 0;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 #include <stdexcept>
 #include <random>
@@ -41,3 +42,28 @@ private:
 };
 
 inline RandomNumberGenerator randomNumber;
+
+
+/**
+ * Philox2x32-10 counter based random number generator.
+ *
+ * Returns the same random bits for the same counter and key every time so
+ * results can be produced in any order, or in parallel, and still come out
+ * the same. Use a counter made up of whatever identifies the draw, like a
+ * position and a turn number.
+ */
+constexpr std::uint64_t philox2x32(std::uint64_t counter, std::uint32_t key)
+{
+	auto left = static_cast<std::uint32_t>(counter >> 32);
+	auto right = static_cast<std::uint32_t>(counter);
+
+	for (int round = 0; round < 10; ++round)
+	{
+		const auto product = std::uint64_t{0xD256D345} * right;
+		right = static_cast<std::uint32_t>(product >> 32) ^ key ^ left;
+		left = static_cast<std::uint32_t>(product);
+		key += 0x9E3779B9;
+	}
+
+	return (std::uint64_t{left} << 32) | right;
+}
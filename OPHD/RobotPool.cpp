@@ -1,8 +1,7 @@
 #include "RobotPool.h"
-#include "RobotPoolHelper.h"
 #include "Map/Tile.h"
 
-#include <algorithm>
+#include <stdexcept>
 
 
 int ROBOT_ID_COUNTER = 0; /// \fixme Kludge
@@ -25,23 +24,39 @@ RobotPool::~RobotPool()
 
 void RobotPool::clear()
 {
-	clearRobots(mDiggers);
-	clearRobots(mDozers);
-	clearRobots(mMiners);
-	mRobots.clear();
+	mDiggers.clear();
+	mDozers.clear();
+	mMiners.clear();
 
 	mRobotControlCount = 0;
 	mRobotControlMax = 0;
 }
 
 
+/**
+ * Removes a robot from the pool and destroys it.
+ *
+ * \warning	Any pointers to the robot are left dangling.
+ */
 void RobotPool::erase(Robot* robot)
 {
-	mRobots.erase(find(mRobots.begin(), mRobots.end(), robot));
+	switch (robot->type())
+	{
+	case Robot::Type::Digger:
+		mDiggers.remove(*static_cast<Robodigger*>(robot));
+		break;
 
-	eraseRobot(mDiggers, robot);
-	eraseRobot(mDozers, robot);
-	eraseRobot(mMiners, robot);
+	case Robot::Type::Dozer:
+		mDozers.remove(*static_cast<Robodozer*>(robot));
+		break;
+
+	case Robot::Type::Miner:
+		mMiners.remove(*static_cast<Robominer*>(robot));
+		break;
+
+	default:
+		throw std::runtime_error("RobotPool::erase(): Robot has an invalid type.");
+	}
 }
 
 
@@ -67,31 +82,28 @@ Robot* RobotPool::addRobot(Robot::Type type)
  */
 Robot* RobotPool::addRobot(Robot::Type type, int id)
 {
+	Robot* robot = nullptr;
+
 	switch (type)
 	{
 	case Robot::Type::Dozer:
-		mDozers.push_back(new Robodozer());
-		mDozers.back()->id(id);
-		mRobots.push_back(mDozers.back());
-		return mDozers.back();
+		robot = &mDozers.add();
+		break;
 
 	case Robot::Type::Digger:
-		mDiggers.push_back(new Robodigger());
-		mDiggers.back()->id(id);
-		mRobots.push_back(mDiggers.back());
-		return mDiggers.back();
+		robot = &mDiggers.add();
+		break;
 
 	case Robot::Type::Miner:
-		mMiners.push_back(new Robominer());
-		mMiners.back()->id(id);
-		mRobots.push_back(mMiners.back());
-		return mMiners.back();
+		robot = &mMiners.add();
+		break;
 
 	default:
-		break;
+		return nullptr;
 	}
 
-	return nullptr;
+	robot->id(id);
+	return robot;
 }
 
 
@@ -102,7 +114,7 @@ Robot* RobotPool::addRobot(Robot::Type type, int id)
  */
 Robodigger* RobotPool::getDigger()
 {
-	return static_cast<Robodigger*>(getRobot(mDiggers));
+	return mDiggers.idle();
 }
 
 
@@ -113,7 +125,7 @@ Robodigger* RobotPool::getDigger()
  */
 Robodozer* RobotPool::getDozer()
 {
-	return static_cast<Robodozer*>(getRobot(mDozers));
+	return mDozers.idle();
 }
 
 
@@ -124,7 +136,7 @@ Robodozer* RobotPool::getDozer()
  */
 Robominer* RobotPool::getMiner()
 {
-	return static_cast<Robominer*>(getRobot(mMiners));
+	return mMiners.idle();
 }
 
 
@@ -133,42 +145,43 @@ Robominer* RobotPool::getMiner()
  * 
  * \return	Returns true if the requested robot type is available. False otherwise.
  */
-bool RobotPool::robotAvailable(Robot::Type type)
+bool RobotPool::robotAvailable(Robot::Type type) const
+{
+	return getAvailableCount(type) > 0;
+}
+
+
+int RobotPool::getAvailableCount(Robot::Type type) const
 {
 	switch (type)
 	{
 	case Robot::Type::Digger:
-	{
-		return getDigger() != nullptr;
-	}
+		return static_cast<int>(mDiggers.idleCount());
+
 	case Robot::Type::Dozer:
-	{
-		return getDozer() != nullptr;
-	}
+		return static_cast<int>(mDozers.idleCount());
+
 	case Robot::Type::Miner:
-	{
-		return getMiner() != nullptr;
-	}
+		return static_cast<int>(mMiners.idleCount());
+
 	default:
-	{
-		return false;
-	}
+		return 0;
 	}
 }
 
 
-int RobotPool::getAvailableCount(Robot::Type type)
+std::size_t RobotPool::robotCount(Robot::Type type) const
 {
 	switch (type)
 	{
 	case Robot::Type::Digger:
-		return getIdleCount(mDiggers);
+		return mDiggers.size();
 
 	case Robot::Type::Dozer:
-		return getIdleCount(mDozers);
+		return mDozers.size();
 
 	case Robot::Type::Miner:
-		return getIdleCount(mMiners);
+		return mMiners.size();
 
 	default:
 		return 0;
@@ -176,14 +189,67 @@ int RobotPool::getAvailableCount(Robot::Type type)
 }
 
 
+RobotHandle RobotPool::handle(const Robot& robot) const
+{
+	return {robot.type(), robot.poolIndex().slot, robot.poolIndex().generation};
+}
+
+
+/**
+ * Gets the robot a handle refers to.
+ *
+ * \return	Returns a pointer to the robot, or nullptr if it has been erased.
+ */
+Robot* RobotPool::find(RobotHandle handle)
+{
+	switch (handle.type)
+	{
+	case Robot::Type::Digger:
+		return mDiggers.find(handle.slot, handle.generation);
+
+	case Robot::Type::Dozer:
+		return mDozers.find(handle.slot, handle.generation);
+
+	case Robot::Type::Miner:
+		return mMiners.find(handle.slot, handle.generation);
+
+	default:
+		return nullptr;
+	}
+}
+
+
+/**
+ * Gets every robot in the pool, grouped by type.
+ *
+ * \note	Builds a new list on every call. Meant for saving and loading,
+ *			not for use every frame.
+ */
+RobotList RobotPool::robots()
+{
+	RobotList robots;
+	robots.reserve(size());
+
+	const auto append = [&robots](Robot& robot) { robots.push_back(&robot); };
+	mDiggers.forEach(append);
+	mDozers.forEach(append);
+	mMiners.forEach(append);
+
+	return robots;
+}
+
+
+/**
+ * \note	Every robot that isn't idle counts against command capacity,
+ *			including ones that died this turn and haven't been removed
+ *			yet.
+ */
 void RobotPool::InitRobotCtrl(uint32_t maxRobotCtrl)
 {
 	mRobotControlMax = maxRobotCtrl;
-	mRobotControlCount = 0;
 
-	updateRobotControlCount(mDiggers, mRobotControlCount);
-	updateRobotControlCount(mDozers, mRobotControlCount);
-	updateRobotControlCount(mMiners, mRobotControlCount);
+	const auto idleCount = mDiggers.idleCount() + mDozers.idleCount() + mMiners.idleCount();
+	mRobotControlCount = static_cast<uint32_t>(size() - idleCount);
 }
 
 
@@ -196,6 +262,9 @@ void RobotPool::AddRobotCtrl()
 }
 
 
+/**
+ * Deploys a robot onto a tile, taking it off its idle list.
+ */
 bool RobotPool::insertRobotIntoTable(RobotTileTable& robotMap, Robot* robot, Tile* tile)
 {
 	if (!tile) { return false; }
@@ -206,7 +275,51 @@ bool RobotPool::insertRobotIntoTable(RobotTileTable& robotMap, Robot* robot, Til
 	robotMap[robot] = tile;
 	tile->pushThing(robot);
 
+	switch (robot->type())
+	{
+	case Robot::Type::Digger:
+		mDiggers.claim(*static_cast<Robodigger*>(robot));
+		break;
+
+	case Robot::Type::Dozer:
+		mDozers.claim(*static_cast<Robodozer*>(robot));
+		break;
+
+	case Robot::Type::Miner:
+		mMiners.claim(*static_cast<Robominer*>(robot));
+		break;
+
+	default:
+		break;
+	}
+
 	AddRobotCtrl();
 
 	return true;
 }
+
+
+/**
+ * Puts a robot that has finished or abandoned its task back on its
+ * idle list.
+ */
+void RobotPool::releaseRobot(Robot* robot)
+{
+	switch (robot->type())
+	{
+	case Robot::Type::Digger:
+		mDiggers.release(*static_cast<Robodigger*>(robot));
+		break;
+
+	case Robot::Type::Dozer:
+		mDozers.release(*static_cast<Robodozer*>(robot));
+		break;
+
+	case Robot::Type::Miner:
+		mMiners.release(*static_cast<Robominer*>(robot));
+		break;
+
+	default:
+		break;
+	}
+}
@@ -2,18 +2,43 @@
 
 
 #include "Things/Robots/Robots.h"
+#include "RobotPoolHelper.h"
+
+#include <unordered_map>
 
 
 class Tile;
 
 
+/**
+ * Identifies a robot in a RobotPool without holding a pointer to it.
+ *
+ * A handle to a robot that has been erased no longer resolves, even if a
+ * new robot has taken its place.
+ */
+struct RobotHandle
+{
+	Robot::Type type = Robot::Type::None;
+	std::size_t slot = 0;
+	std::uint32_t generation = 0;
+};
+
+
+/**
+ * Owns every robot in the colony.
+ *
+ * Robots of each type are stored together in a slot map that keeps track
+ * of which of them are idle. Adding, erasing, finding an idle robot and
+ * counting idle robots are all O(1).
+ *
+ * A robot is idle from when it's added until it's deployed with
+ * insertRobotIntoTable(), and again once it's handed back with
+ * releaseRobot().
+ */
 class RobotPool
 {
 public:
-	using DiggerList = std::vector<Robodigger*>;
-	using DozerList = std::vector<Robodozer*>;
-	using MinerList = std::vector<Robominer*>;
-	using RobotTileTable = std::map<Robot*, Tile*>;
+	using RobotTileTable = std::unordered_map<Robot*, Tile*>;
 
 public:
 	RobotPool();
@@ -26,34 +51,34 @@ public:
 	Robodozer* getDozer();
 	Robominer* getMiner();
 
-	bool robotAvailable(Robot::Type type);
-	int getAvailableCount(Robot::Type type);
+	bool robotAvailable(Robot::Type type) const;
+	int getAvailableCount(Robot::Type type) const;
+	std::size_t robotCount(Robot::Type type) const;
+
+	RobotHandle handle(const Robot& robot) const;
+	Robot* find(RobotHandle handle);
 
 	void InitRobotCtrl(uint32_t MaxRobotCtrl);
 	bool robotCtrlAvailable() { return mRobotControlCount < mRobotControlMax; }
-	bool commandCapacityAvailable() { return mRobots.size() < mRobotControlMax; }
+	bool commandCapacityAvailable() const { return size() < mRobotControlMax; }
 	void AddRobotCtrl();
 
-	DiggerList& diggers() { return mDiggers; }
-	DozerList& dozers() { return mDozers; }
-	MinerList& miners() { return mMiners; }
-
 	void clear();
 	void erase(Robot* robot);
 	bool insertRobotIntoTable(RobotTileTable& robotMap, Robot* robot, Tile* tile);
+	void releaseRobot(Robot* robot);
 
 	uint32_t robotControlMax() { return mRobotControlMax; }
 	uint32_t currentControlCount() { return mRobotControlCount; }
 	uint32_t availableControlCount() { return robotControlMax() - currentControlCount(); }
 
-	const RobotList& robots() const { return mRobots; }
+	std::size_t size() const { return mDiggers.size() + mDozers.size() + mMiners.size(); }
+	RobotList robots();
 
 private:
-	DiggerList mDiggers;
-	DozerList mDozers;
-	MinerList mMiners;
-
-	RobotList mRobots; // List of all robots by pointer to base class
+	RobotSlots<Robodigger> mDiggers;
+	RobotSlots<Robodozer> mDozers;
+	RobotSlots<Robominer> mMiners;
 
 	uint32_t mRobotControlMax = 0;
 	uint32_t mRobotControlCount = 0;
@@ -1,64 +1,122 @@
 /**
- * Templete helper functions used exclusively by RobotPool.
- * 
- * This header and its functions should not be used anywhere else,
+ * Template helpers used exclusively by RobotPool.
+ *
+ * This header and its contents should not be used anywhere else,
  * these are designed specifically to help improve code readability
  * and maintainability of the RobotPool class.
  */
 #pragma once
 
-template <class T>
-void clearRobots(T& t)
-{
-	for (auto robot : t)
-	{
-		delete robot;
-	}
-
-	t.clear();
-}
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <vector>
 
 
+/**
+ * Slot map holding every robot of one type.
+ *
+ * Robots are constructed in place in a deque of slots so their addresses
+ * never change while they're alive. Freed slots are reused and bump the
+ * slot's generation so stale handles can be told apart from the robot now
+ * living in the slot.
+ *
+ * Idle robots are kept in a separate list so finding, counting, claiming
+ * and releasing them is O(1). Each robot remembers its slot and position in
+ * the idle list through Robot::poolIndex().
+ */
 template <class T>
-Robot* getRobot(const T& t)
+class RobotSlots
 {
-	for (auto robot : t)
+public:
+	static constexpr std::size_t NotIdle = std::numeric_limits<std::size_t>::max();
+
+	T& add()
 	{
-		if (robot->idle()) { return robot; }
+		std::size_t slot = mSlots.size();
+		if (mFreeSlots.empty())
+		{
+			mSlots.emplace_back();
+			mGenerations.push_back(0);
+		}
+		else
+		{
+			slot = mFreeSlots.back();
+			mFreeSlots.pop_back();
+		}
+
+		auto& robot = mSlots[slot].emplace();
+		robot.poolIndex() = {slot, mGenerations[slot], NotIdle};
+		release(robot);
+		++mCount;
+		return robot;
 	}
-	return nullptr;
-}
 
+	void remove(T& robot)
+	{
+		const auto slot = robot.poolIndex().slot;
+		claim(robot);
+		++mGenerations[slot];
+		mSlots[slot].reset();
+		mFreeSlots.push_back(slot);
+		--mCount;
+	}
 
-template <class T>
-int getIdleCount(const T& t)
-{
-	int count = 0;
-	for (auto robot : t)
+	T* find(std::size_t slot, std::uint32_t generation)
 	{
-		if (robot->idle()) { ++count; }
+		if (slot >= mSlots.size() || mGenerations[slot] != generation || !mSlots[slot]) { return nullptr; }
+		return &*mSlots[slot];
 	}
 
-	return count;
-}
+	/** Takes a robot off the idle list. Does nothing if it isn't on it. */
+	void claim(T& robot)
+	{
+		auto& index = robot.poolIndex().idle;
+		if (index == NotIdle) { return; }
 
+		mIdle[index] = mIdle.back();
+		mIdle[index]->poolIndex().idle = index;
+		mIdle.pop_back();
+		index = NotIdle;
+	}
 
-template <class T>
-void updateRobotControlCount(const T& t, uint32_t& controlCounter)
-{
-	for (auto robot : t)
+	/** Puts a robot on the idle list. Does nothing if it's already on it. */
+	void release(T& robot)
 	{
-		if (!robot->idle() && !robot->dead()) { ++controlCounter; }
+		auto& index = robot.poolIndex().idle;
+		if (index != NotIdle) { return; }
+
+		index = mIdle.size();
+		mIdle.push_back(&robot);
 	}
-}
 
+	T* idle() const { return mIdle.empty() ? nullptr : mIdle.back(); }
+	std::size_t idleCount() const { return mIdle.size(); }
+	std::size_t size() const { return mCount; }
 
-template <class T>
-void eraseRobot(T& t, Robot* robot)
-{
-	auto it = find(t.begin(), t.end(), robot);
-	if (it != t.end())
+	template <class Function>
+	void forEach(Function function)
+	{
+		for (auto& slot : mSlots)
+		{
+			if (slot) { function(*slot); }
+		}
+	}
+
+	void clear()
 	{
-		t.erase(it);
+		mSlots.clear();
+		mGenerations.clear();
+		mFreeSlots.clear();
+		mIdle.clear();
+		mCount = 0;
 	}
-}
+
+private:
+	std::deque<std::optional<T>> mSlots;
+	std::vector<std::uint32_t> mGenerations;
+	std::vector<std::size_t> mFreeSlots;
+	std::vector<T*> mIdle;
+	std::size_t mCount = 0;
+};
@@ -0,0 +1,146 @@
+#include "SavegameInfo.h"
+
+#include "Constants/Strings.h"
+#include "XmlSerializer.h"
+
+#include <NAS2D/Utility.h>
+#include <NAS2D/Filesystem.h>
+#include <NAS2D/ParserHelper.h>
+#include <NAS2D/Xml/XmlDocument.h>
+#include <NAS2D/Xml/XmlMemoryBuffer.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+using namespace NAS2D;
+
+
+namespace
+{
+	const std::string SavegameExtension = ".xml";
+
+
+	bool hasSavegameExtension(const std::string& filename)
+	{
+		return filename.size() > SavegameExtension.size() &&
+			filename.compare(filename.size() - SavegameExtension.size(), SavegameExtension.size(), SavegameExtension) == 0;
+	}
+
+
+	std::string stripSavegameExtension(const std::string& filename)
+	{
+		return filename.substr(0, filename.size() - SavegameExtension.size());
+	}
+}
+
+
+/**
+ * Gets the path of the sidecar info file for a savegame.
+ */
+std::string savegameInfoPath(const std::string& savegamePath)
+{
+	const auto basePath = hasSavegameExtension(savegamePath) ? stripSavegameExtension(savegamePath) : savegamePath;
+	return basePath + constants::SaveGameInfoExtension;
+}
+
+
+void writeSavegameInfo(const std::string& savegamePath, const SavegameInfo& info)
+{
+	Xml::XmlDocument doc;
+
+	doc.linkEndChild(dictionaryToAttributes(
+		constants::SaveGameInfoRootNode,
+		{{
+			{"version", info.version},
+			{"turn", info.turn},
+			{"population", info.population},
+			{"planet", info.planet},
+			{"structures", info.structureCount},
+			{"thumbnail_width", info.thumbnailWidth},
+			{"thumbnail_height", info.thumbnailHeight},
+			{"thumbnail", info.thumbnail},
+		}}
+	));
+
+	Xml::XmlMemoryBuffer buff;
+	doc.accept(&buff);
+
+	Utility<Filesystem>::get().write(savegameInfoPath(savegamePath), buff.buffer());
+}
+
+
+/**
+ * Reads the sidecar info file for a savegame.
+ *
+ * \throws	Throws a std::runtime_error if the info file is missing or malformed.
+ */
+SavegameInfo readSavegameInfo(const std::string& savegamePath)
+{
+	const auto infoPath = savegameInfoPath(savegamePath);
+	if (!Utility<Filesystem>::get().exists(infoPath))
+	{
+		throw std::runtime_error("readSavegameInfo(): No info file for '" + savegamePath + "'");
+	}
+
+	auto xmlDocument = openXmlFile(infoPath, constants::SaveGameInfoRootNode);
+	const auto dictionary = attributesToDictionary(*xmlDocument.firstChildElement(constants::SaveGameInfoRootNode));
+
+	SavegameInfo info;
+	info.hasInfo = true;
+	info.version = dictionary.get("version");
+	info.turn = dictionary.get<int>("turn");
+	info.population = dictionary.get<int>("population");
+	info.planet = dictionary.get("planet");
+	info.structureCount = dictionary.get<int>("structures");
+	info.thumbnailWidth = dictionary.get<int>("thumbnail_width", 0);
+	info.thumbnailHeight = dictionary.get<int>("thumbnail_height", 0);
+	info.thumbnail = dictionary.get("thumbnail", std::string{});
+
+	if (info.thumbnail.size() != static_cast<std::size_t>(info.thumbnailWidth * info.thumbnailHeight))
+	{
+		info.thumbnailWidth = 0;
+		info.thumbnailHeight = 0;
+		info.thumbnail.clear();
+	}
+
+	return info;
+}
+
+
+/**
+ * Lists the savegames in a directory along with their info.
+ *
+ * Only the sidecar info files are read, the savegames themselves are
+ * never opened. Savegames without a usable info file are still listed
+ * with SavegameInfo::hasInfo set to false.
+ *
+ * \note	Safe to call from a worker thread. It doesn't touch any UI state.
+ */
+std::vector<SavegameInfo> scanSavegames(const std::string& directory)
+{
+	const auto& filesystem = Utility<Filesystem>::get();
+	auto dirList = filesystem.directoryList(directory);
+	std::sort(dirList.begin(), dirList.end());
+
+	std::vector<SavegameInfo> savegames;
+	for (const auto& filename : dirList)
+	{
+		if (!hasSavegameExtension(filename) || filesystem.isDirectory(directory + filename)) { continue; }
+
+		SavegameInfo info;
+		try
+		{
+			info = readSavegameInfo(directory + filename);
+		}
+		catch (const std::exception&)
+		{
+			// Older saves don't have an info file. Still list them.
+		}
+
+		info.name = stripSavegameExtension(filename);
+		savegames.push_back(info);
+	}
+
+	return savegames;
+}
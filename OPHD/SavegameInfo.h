@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+
+/**
+ * Summary of a saved game.
+ *
+ * Written to a small sidecar file next to each save so that the file
+ * dialog can describe a save without parsing the entire document.
+ */
+struct SavegameInfo
+{
+	static constexpr char ThumbnailEmpty = '.';
+	static constexpr char ThumbnailStructure = 's';
+	static constexpr char ThumbnailMine = 'm';
+
+	std::string name; /**< Savegame name without path or extension. */
+	bool hasInfo = false; /**< False if the sidecar was missing or unreadable. */
+
+	std::string version;
+	int turn = 0;
+	int population = 0;
+	std::string planet;
+	int structureCount = 0;
+
+	int thumbnailWidth = 0;
+	int thumbnailHeight = 0;
+	std::string thumbnail; /**< Row-major surface overview, one character per cell. */
+};
+
+
+std::string savegameInfoPath(const std::string& savegamePath);
+
+void writeSavegameInfo(const std::string& savegamePath, const SavegameInfo& info);
+SavegameInfo readSavegameInfo(const std::string& savegamePath);
+
+std::vector<SavegameInfo> scanSavegames(const std::string& directory);
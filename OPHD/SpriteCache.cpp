@@ -0,0 +1,130 @@
+#include "SpriteCache.h"
+
+#include "XmlSerializer.h"
+
+#include <NAS2D/Utility.h>
+#include <NAS2D/Filesystem.h>
+
+
+namespace
+{
+	/**
+	 * Reads which actions in a sprite file have more than one frame.
+	 * Actions with a single frame never need the sprite redrawn.
+	 */
+	std::set<std::string> readAnimatedActions(const std::string& spritePath)
+	{
+		std::set<std::string> animatedActions;
+
+		const auto xmlDocument = openXmlFile(spritePath, "sprite");
+		const auto* root = xmlDocument.firstChildElement("sprite");
+		for (const auto* action = root->firstChildElement("action"); action; action = action->nextSiblingElement("action"))
+		{
+			const auto* firstFrame = action->firstChildElement("frame");
+			if (firstFrame && firstFrame->nextSiblingElement("frame"))
+			{
+				animatedActions.insert(action->attribute("name"));
+			}
+		}
+
+		return animatedActions;
+	}
+
+
+	/**
+	 * Reads the animated actions of every sprite file in the given directories.
+	 *
+	 * \note	Safe to call from a worker thread. It doesn't touch the renderer.
+	 */
+	std::map<std::string, std::set<std::string>> readAllAnimatedActions(const std::vector<std::string>& directories)
+	{
+		const std::string extension{".sprite"};
+		const auto& filesystem = NAS2D::Utility<NAS2D::Filesystem>::get();
+
+		std::map<std::string, std::set<std::string>> animatedActions;
+		for (const auto& directory : directories)
+		{
+			for (const auto& filename : filesystem.directoryList(directory))
+			{
+				if (filename.size() <= extension.size() || filename.compare(filename.size() - extension.size(), extension.size(), extension) != 0) { continue; }
+
+				const auto spritePath = directory + filename;
+				animatedActions[spritePath] = readAnimatedActions(spritePath);
+			}
+		}
+
+		return animatedActions;
+	}
+}
+
+
+/**
+ * Starts reading which actions are animated for every sprite file in
+ * the given directories on a worker thread.
+ *
+ * \param	directories	Directories to look in, each ending with a '/'.
+ */
+void SpriteCache::preload(const std::vector<std::string>& directories)
+{
+	if (mPreload.valid()) { return; }
+	mPreload = std::async(std::launch::async, readAllAnimatedActions, directories);
+}
+
+
+/**
+ * Gets a new sprite for the given sprite file playing \c initialAction.
+ *
+ * The sprite file is only loaded the first time it's asked for.
+ */
+NAS2D::Sprite SpriteCache::sprite(const std::string& spritePath, const std::string& initialAction)
+{
+	auto it = mSprites.find(spritePath);
+	if (it == mSprites.end())
+	{
+		finishPreload();
+		it = mSprites.emplace(spritePath, NAS2D::Sprite{spritePath, initialAction}).first;
+		if (mAnimatedActions.count(spritePath) == 0)
+		{
+			mAnimatedActions[spritePath] = readAnimatedActions(spritePath);
+		}
+	}
+
+	NAS2D::Sprite sprite{it->second};
+	sprite.play(initialAction);
+	return sprite;
+}
+
+
+/**
+ * Gets whether playing \c action shows more than one frame.
+ *
+ * \note	Only knows about sprite files already loaded with sprite().
+ */
+bool SpriteCache::animated(const std::string& spritePath, const std::string& action) const
+{
+	const auto it = mAnimatedActions.find(spritePath);
+	return it != mAnimatedActions.end() && it->second.count(action) > 0;
+}
+
+
+void SpriteCache::clear()
+{
+	// Waits on a running preload without rethrowing its errors
+	mPreload = {};
+	mSprites.clear();
+	mAnimatedActions.clear();
+}
+
+
+/**
+ * Waits on the preload if one is running and keeps what it read.
+ *
+ * \throws	Rethrows any error raised while reading the sprite files.
+ */
+void SpriteCache::finishPreload()
+{
+	if (!mPreload.valid()) { return; }
+
+	auto animatedActions = mPreload.get();
+	mAnimatedActions.insert(animatedActions.begin(), animatedActions.end());
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <NAS2D/Resource/Sprite.h>
+
+#include <future>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+
+/**
+ * Loads each sprite file once and hands out copies of it.
+ *
+ * Every structure and robot has its own sprite so it can play its own
+ * action. Copying an already loaded sprite skips reading and parsing
+ * the sprite file again for each of the thousands of roads, tubes and
+ * residences on a large map.
+ *
+ * Which actions are animated can be read ahead of time on a worker
+ * thread with preload().
+ *
+ * \note	Not thread safe. Things are only created on the main thread.
+ */
+class SpriteCache
+{
+public:
+	void preload(const std::vector<std::string>& directories);
+
+	NAS2D::Sprite sprite(const std::string& spritePath, const std::string& initialAction);
+	bool animated(const std::string& spritePath, const std::string& action) const;
+
+	std::size_t size() const { return mSprites.size(); }
+	void clear();
+
+private:
+	using AnimatedActions = std::map<std::string, std::set<std::string>>;
+
+	void finishPreload();
+
+	std::map<std::string, NAS2D::Sprite> mSprites; /**< Loaded sprites by file path. Never drawn or played. */
+	AnimatedActions mAnimatedActions; /**< Actions with more than one frame by sprite file path. */
+	std::future<AnimatedActions> mPreload;
+};
@@ -0,0 +1,77 @@
+#include "StartupTimer.h"
+
+#include <NAS2D/Utility.h>
+
+#include <iomanip>
+
+
+StartupTimer::Stage::Stage(const std::string& name) :
+	mRecord{NAS2D::Utility<StartupTimer>::get().begin(name)}
+{
+}
+
+
+StartupTimer::Stage::~Stage()
+{
+	end();
+}
+
+
+/**
+ * Ends this stage and starts timing another at the same depth.
+ */
+void StartupTimer::Stage::next(const std::string& name)
+{
+	end();
+	mRecord = NAS2D::Utility<StartupTimer>::get().begin(name);
+	mRunning = true;
+}
+
+
+void StartupTimer::Stage::end()
+{
+	if (!mRunning) { return; }
+
+	NAS2D::Utility<StartupTimer>::get().end(mRecord);
+	mRunning = false;
+}
+
+
+std::size_t StartupTimer::begin(const std::string& name)
+{
+	mRecords.push_back({name, mOpenStages, Clock::now(), Clock::duration{0}});
+	++mOpenStages;
+	return mRecords.size() - 1;
+}
+
+
+void StartupTimer::end(std::size_t record)
+{
+	mRecords[record].duration = Clock::now() - mRecords[record].start;
+	--mOpenStages;
+}
+
+
+/**
+ * Writes the recorded stages and their total, then clears them.
+ *
+ * \note	Does nothing while a stage is still running. The stages are
+ *			reported by the next call once the outermost stage has ended.
+ */
+void StartupTimer::report(std::ostream& out)
+{
+	if (mOpenStages > 0 || mRecords.empty()) { return; }
+
+	Clock::duration total{0};
+	out << "Startup timing:" << std::endl;
+	for (const auto& record : mRecords)
+	{
+		if (record.depth == 0) { total += record.duration; }
+
+		const auto indent = 2 + 2 * static_cast<int>(record.depth);
+		out << std::string(static_cast<std::size_t>(indent), ' ') << std::left << std::setw(30 - indent) << record.name << std::right << std::setw(8) << std::chrono::duration_cast<std::chrono::milliseconds>(record.duration).count() << " ms" << std::endl;
+	}
+	out << "  " << std::left << std::setw(28) << "Total" << std::right << std::setw(8) << std::chrono::duration_cast<std::chrono::milliseconds>(total).count() << " ms" << std::endl;
+
+	mRecords.clear();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/**
+ * Records how long each stage of startup takes so slow stages show
+ * up in the log.
+ *
+ * Stages are timed by StartupTimer::Stage and can be nested. A stage
+ * started while another is running is reported indented beneath it.
+ *
+ * \note	Not thread safe. Stages are only recorded from the main thread.
+ */
+class StartupTimer
+{
+public:
+	/**
+	 * Times a stage from construction until it's destroyed or end() or
+	 * next() is called.
+	 */
+	class Stage
+	{
+	public:
+		explicit Stage(const std::string& name);
+		~Stage();
+
+		Stage(const Stage&) = delete;
+		Stage& operator=(const Stage&) = delete;
+
+		void next(const std::string& name);
+		void end();
+
+	private:
+		std::size_t mRecord;
+		bool mRunning = true;
+	};
+
+	void report(std::ostream& out);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Record
+	{
+		std::string name;
+		std::size_t depth;
+		Clock::time_point start;
+		Clock::duration duration;
+	};
+
+	std::size_t begin(const std::string& name);
+	void end(std::size_t record);
+
+	std::vector<Record> mRecords;
+	std::size_t mOpenStages = 0;
+};
@@ -5,14 +5,36 @@
 #include "../RandomNumberGenerator.h"
 #include <NAS2D/Utility.h>
 
-
-void CrimeRateUpdate::update(const std::vector<TileList>& policeOverlays)
+#include <algorithm>
+#include <limits>
+
+
+CrimeRateUpdate::CrimeRateUpdate() :
+	mSeed{randomNumber.generate<std::uint32_t>(0, std::numeric_limits<std::uint32_t>::max())}
+{}
+
+
+/**
+ * Updates crime rates and picks which structures commit crimes this turn.
+ *
+ * Structures are processed in passes over flat arrays: look up tiles, then
+ * work out crime rate changes and crime rolls, then apply the results.
+ * Nothing in the middle pass depends on any other structure so it can be
+ * split up and run in any order.
+ *
+ * \param	turn	Current turn number. Crime rolls are drawn from a counter
+ *					based generator keyed by the structure's location and the
+ *					turn so they don't depend on the order structures are
+ *					processed in.
+ */
+void CrimeRateUpdate::update(const std::vector<TileList>& policeOverlays, int turn)
 {
 	mMeanCrimeRate = 0;
 	mStructuresCommittingCrimes.clear();
 	mMoraleChanges.clear();
 
-	const auto& structuresWithCrime = NAS2D::Utility<StructureManager>::get().structuresWithCrime();
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
+	const auto& structuresWithCrime = structureManager.structuresWithCrime();
 
 	// Colony will not have a crime rate until at least one structure that supports crime is built
 	if (structuresWithCrime.empty())
@@ -20,17 +42,39 @@ void CrimeRateUpdate::update(const std::vector<TileList>& policeOverlays)
 		return;
 	}
 
+	updatePoliceCoverage(policeOverlays);
+
+	const auto count = structuresWithCrime.size();
+	mTiles.resize(count);
+	mCrimeRateChanges.resize(count);
+	mCrimeRolls.resize(count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		mTiles[i] = &structureManager.tileFromStructure(structuresWithCrime[i]);
+	}
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const auto& tile = *mTiles[i];
+		const auto depth = static_cast<std::size_t>(tile.depth());
+		const bool isProtected = depth < mPoliceCoverage.size() && mPoliceCoverage[depth].contains(tile.position());
+		mCrimeRateChanges[i] = isProtected ? -1 : 1;
+		mCrimeRolls[i] = crimeRoll(tile, turn);
+	}
+
+	const auto crimeChance = chanceCrimeOccurs[mDifficulty];
 	double accumulatedCrime{ 0 };
 
-	for (auto structure : structuresWithCrime)
+	for (std::size_t i = 0; i < count; ++i)
 	{
-		int crimeRateChange = isProtectedByPolice(policeOverlays, structure) ? -1 : 1;
-		structure->increaseCrimeRate(crimeRateChange);
+		auto structure = structuresWithCrime[i];
+		structure->increaseCrimeRate(mCrimeRateChanges[i]);
 
 		// Crime Rate of 0% means no crime
 		// Crime Rate of 100% means crime occurs 10% of the time on medium difficulty
 		// chanceCrimeOccurs multiplier increases or decreases chance based on difficulty
-		if (structure->crimeRate() * chanceCrimeOccurs[mDifficulty] + randomNumber.generate<int>(0, 1000) > 1000)
+		if (structure->crimeRate() * crimeChance + mCrimeRolls[i] > 1000)
 		{
 			mStructuresCommittingCrimes.push_back(structure);
 		}
@@ -38,25 +82,79 @@ void CrimeRateUpdate::update(const std::vector<TileList>& policeOverlays)
 		accumulatedCrime += structure->crimeRate();
 	}
 
-	mMeanCrimeRate = static_cast<int>(accumulatedCrime / structuresWithCrime.size());
+	mMeanCrimeRate = static_cast<int>(accumulatedCrime / count);
 
 	updateMoraleChanges();
 }
 
 
-bool CrimeRateUpdate::isProtectedByPolice(const std::vector<TileList>& policeOverlays, Structure* structure)
+bool CrimeRateUpdate::PoliceCoverage::contains(NAS2D::Point<int> position) const
+{
+	const auto offset = position - origin;
+	if (offset.x < 0 || offset.y < 0 || offset.x >= size.x || offset.y >= size.y) { return false; }
+	return covered[static_cast<std::size_t>(offset.y * size.x + offset.x)];
+}
+
+
+/**
+ * Rebuilds the police coverage bitmaps from the police overlays so checking
+ * whether a structure is protected doesn't need to search the overlay.
+ */
+void CrimeRateUpdate::updatePoliceCoverage(const std::vector<TileList>& policeOverlays)
 {
-	const auto& structureTile = NAS2D::Utility<StructureManager>::get().tileFromStructure(structure);
+	mPoliceCoverage.resize(policeOverlays.size());
 
-	for (const auto& tile : policeOverlays[structureTile.depth()])
+	for (std::size_t depth = 0; depth < policeOverlays.size(); ++depth)
 	{
-		if (tile->position() == structureTile.position())
+		const auto& overlay = policeOverlays[depth];
+		auto& coverage = mPoliceCoverage[depth];
+		coverage.covered.clear();
+
+		if (overlay.empty())
+		{
+			coverage.origin = {0, 0};
+			coverage.size = {0, 0};
+			continue;
+		}
+
+		auto topLeft = overlay.front()->position();
+		auto bottomRight = topLeft;
+		for (const auto& tile : overlay)
+		{
+			const auto position = tile->position();
+			topLeft = {std::min(topLeft.x, position.x), std::min(topLeft.y, position.y)};
+			bottomRight = {std::max(bottomRight.x, position.x), std::max(bottomRight.y, position.y)};
+		}
+
+		coverage.origin = topLeft;
+		coverage.size = bottomRight - topLeft + NAS2D::Vector{1, 1};
+		coverage.covered.resize(static_cast<std::size_t>(coverage.size.x * coverage.size.y), false);
+
+		for (const auto& tile : overlay)
 		{
-			return true;
+			const auto offset = tile->position() - coverage.origin;
+			coverage.covered[static_cast<std::size_t>(offset.y * coverage.size.x + offset.x)] = true;
 		}
 	}
+}
+
 
-	return false;
+/**
+ * Random number from 0 to 1000 for a structure's crime roll.
+ *
+ * \note	Structures are identified by their tile since a tile only holds
+ *			one structure.
+ */
+int CrimeRateUpdate::crimeRoll(const Tile& tile, int turn) const
+{
+	const auto position = tile.position();
+	const auto location = std::uint32_t{static_cast<std::uint16_t>(position.x)} | (std::uint32_t{static_cast<std::uint16_t>(position.y)} << 16);
+	const auto turnAndDepth = (static_cast<std::uint32_t>(turn) << 8) | static_cast<std::uint8_t>(tile.depth());
+	const auto counter = (std::uint64_t{turnAndDepth} << 32) | location;
+	const auto bits = static_cast<std::uint32_t>(philox2x32(counter, mSeed));
+
+	// Maps 32 random bits onto 0..1000
+	return static_cast<int>((std::uint64_t{bits} * 1001) >> 32);
 }
 
 
@@ -2,6 +2,11 @@
 
 #include "../Map/Tile.h"
 #include "../Common.h"
+
+#include <NAS2D/Renderer/Point.h>
+#include <NAS2D/Renderer/Vector.h>
+
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <string>
@@ -13,14 +18,31 @@ class Structure;
 class CrimeRateUpdate
 {
 public:
-	void update(const std::vector<TileList>& policeOverlays);
+	CrimeRateUpdate();
+
+	void update(const std::vector<TileList>& policeOverlays, int turn);
 
 	int meanCrimeRate() const { return mMeanCrimeRate; }
 	std::vector<std::pair<std::string, int>> moraleChanges() const { return mMoraleChanges; }
 	void difficulty(Difficulty difficulty) { mDifficulty = difficulty; }
+	std::uint32_t seed() const { return mSeed; }
+	void seed(std::uint32_t seed) { mSeed = seed; }
 	std::vector<Structure*> structuresCommittingCrimes() const { return mStructuresCommittingCrimes; }
 
 private:
+	/**
+	 * Tiles covered by police on one map level, one bit per tile inside the
+	 * bounding box of the police overlay.
+	 */
+	struct PoliceCoverage
+	{
+		NAS2D::Point<int> origin;
+		NAS2D::Vector<int> size;
+		std::vector<bool> covered;
+
+		bool contains(NAS2D::Point<int> position) const;
+	};
+
 	// Lower number indicates criminal activity occurs more often
 	std::map<Difficulty, float> chanceCrimeOccurs
 	{
@@ -35,7 +57,17 @@ private:
 	std::vector<std::pair<std::string, int>> mMoraleChanges;
 	std::vector<Structure*> mStructuresCommittingCrimes;
 
-	bool isProtectedByPolice(const std::vector<TileList>& policeOverlays, Structure* structure);
+	std::uint32_t mSeed; /**< Key for crime rolls so each game rolls differently. Saved with the game. */
+	std::vector<PoliceCoverage> mPoliceCoverage;
+
+	// Per structure values for the structure at the same index in
+	// StructureManager::structuresWithCrime(). Reused between turns.
+	std::vector<const Tile*> mTiles;
+	std::vector<int> mCrimeRateChanges;
+	std::vector<int> mCrimeRolls;
+
+	void updatePoliceCoverage(const std::vector<TileList>& policeOverlays);
+	int crimeRoll(const Tile& tile, int turn) const;
 	int calculateMoraleChange();
 	void updateMoraleChanges();
 };
@@ -4,6 +4,7 @@
 #include "MapViewState.h"
 #include "MainReportsUiState.h"
 #include "Wrapper.h"
+#include "../FrameScheduler.h"
 #include "../StructureManager.h"
 
 #include <NAS2D/Utility.h>
@@ -154,6 +155,8 @@ void GameState::onShowReports()
 	mActiveState->deactivate();
 	mActiveState = mMainReportsState.get();
 	mActiveState->activate();
+
+	NAS2D::Utility<FrameScheduler>::get().invalidate();
 }
 
 
@@ -168,6 +171,8 @@ void GameState::onHideReports()
 	mActiveState->deactivate();
 	mActiveState = mMapView.get();
 	mActiveState->activate();
+
+	NAS2D::Utility<FrameScheduler>::get().invalidate();
 }
 
 
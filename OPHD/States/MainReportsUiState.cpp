@@ -2,6 +2,7 @@
 
 #include "../Cache.h"
 #include "../Constants.h"
+#include "../FrameScheduler.h"
 
 #include "../UI/Reports/ReportInterface.h"
 
@@ -380,5 +381,6 @@ State* MainReportsUiState::update()
 
 	for (Panel& panel : Panels) { drawPanel(renderer, panel); }
 
+	Utility<FrameScheduler>::get().allowIdle();
 	return this;
 }
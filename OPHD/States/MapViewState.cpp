@@ -4,8 +4,10 @@
 
 #include "../Constants.h"
 #include "../DirectionOffset.h"
+#include "../FrameScheduler.h"
 #include "../Cache.h"
 #include "../GraphWalker.h"
+#include "../StartupTimer.h"
 #include "../StructureCatalogue.h"
 #include "../StructureManager.h"
 
@@ -20,6 +22,8 @@
 #include <NAS2D/Renderer/Renderer.h>
 
 #include <algorithm>
+#include <future>
+#include <iostream>
 #include <sstream>
 #include <vector>
 
@@ -33,6 +37,9 @@ using namespace NAS2D;
 const std::string MAP_TERRAIN_EXTENSION = "_a.png";
 const std::string MAP_DISPLAY_EXTENSION = "_b.png";
 
+// Roughly 30 frames per second while the map is otherwise idle.
+const FrameScheduler::Duration MapAnimationInterval{33};
+
 extern Point<int> MOUSE_COORDS;
 
 
@@ -121,12 +128,21 @@ MapViewState::MapViewState(MainReportsUiState& mainReportsState, const std::stri
 
 MapViewState::MapViewState(MainReportsUiState& mainReportsState, const Planet::Attributes& planetAttributes, Difficulty selectedDifficulty) :
 	mMainReportsState(mainReportsState),
-	mTileMap(new TileMap(planetAttributes.mapImagePath, planetAttributes.tilesetPath, planetAttributes.maxDepth, planetAttributes.maxMines, planetAttributes.hostility)),
 	mCrimeExecution(mNotificationArea),
-	mPlanetAttributes(planetAttributes),
-	mMapDisplay{std::make_unique<Image>(planetAttributes.mapImagePath + MAP_DISPLAY_EXTENSION)},
-	mHeightMap{std::make_unique<Image>(planetAttributes.mapImagePath + MAP_TERRAIN_EXTENSION)}
+	mPlanetAttributes(planetAttributes)
 {
+	// Nothing reads the catalogue until the UI is set up so it's filled in on a worker meanwhile
+	mStructureCatalogueInit = std::async(std::launch::async, StructureCatalogue::init, planetAttributes.meanSolarDistance);
+
+	// The site map images decode on workers while the tile map is built
+	const auto displayPath = planetAttributes.mapImagePath + MAP_DISPLAY_EXTENSION;
+	const auto heightMapPath = planetAttributes.mapImagePath + MAP_TERRAIN_EXTENSION;
+	decodedImageCache.preload({displayPath, heightMapPath});
+	mTileMap = new TileMap(planetAttributes.mapImagePath, planetAttributes.tilesetPath, planetAttributes.maxDepth, planetAttributes.maxMines, planetAttributes.mineSpacing, planetAttributes.hostility);
+	mMapDisplay = decodedImageCache.get(displayPath).upload();
+	mHeightMap = decodedImageCache.get(heightMapPath).upload();
+	decodedImageCache.clear();
+
 	difficulty(selectedDifficulty);
 	ccLocation() = CcNotPlaced;
 	Utility<EventHandler>::get().windowResized().connect(this, &MapViewState::onWindowResized);
@@ -154,7 +170,7 @@ MapViewState::~MapViewState()
 
 	eventHandler.textInputMode(false);
 
-	NAS2D::Utility<std::map<class MineFacility*, Route>>::get().clear();
+	NAS2D::Utility<RouteTable>::get().clear();
 }
 
 
@@ -170,7 +186,11 @@ void MapViewState::setPopulationLevel(PopulationLevel popLevel)
  */
 void MapViewState::initialize()
 {
+	StartupTimer::Stage stage{"Structure catalogue"};
+	if (mStructureCatalogueInit.valid()) { mStructureCatalogueInit.get(); }
+
 	// UI
+	stage.next("Map view UI");
 	initUi();
 	auto& renderer = Utility<Renderer>::get();
 
@@ -182,15 +202,13 @@ void MapViewState::initialize()
 
 	mPopulationPool.population(&mPopulation);
 
+	// StructureCatalogue is initialized in load routine if saved game present to load existing structures
 	if (mLoadingExisting) 
 	{ 
+		stage.next("Savegame load");
 		load(mExistingToLoad); 
 	}
-	else 
-	{ 
-		// StructureCatalogue is initialized in load routine if saved game present to load existing structures
-		StructureCatalogue::init(mPlanetAttributes.meanSolarDistance); 
-	}
+	stage.end();
 
 	resetPoliceOverlays();
 
@@ -212,6 +230,8 @@ void MapViewState::initialize()
 
 	delete mPathSolver;
 	mPathSolver = new micropather::MicroPather(mTileMap);
+
+	Utility<StartupTimer>::get().report(std::cout);
 }
 
 
@@ -259,6 +279,7 @@ State* MapViewState::update()
 		renderer.drawBoxFilled(renderArea, NAS2D::Color::Black);
 		mGameOverDialog.update();
 
+		Utility<FrameScheduler>::get().allowIdle();
 		return this;
 	}
 
@@ -284,34 +305,16 @@ State* MapViewState::update()
 
 	drawUI();
 
-	return this;
-}
-
-
-/**
- * Get the total amount of storage given a structure class and capacity of each
- * structure.
- */
-int MapViewState::totalStorage(Structure::StructureClass structureClass, int capacity)
-{
-	int storageCapacity = 0;
-
-	// Command Center has a limited amount of storage for when colonists first land.
-	if (ccLocation() != CcNotPlaced)
+	// Beacons, animated sprites and glowing resource counts keep changing
+	// without input. With none of them on screen the map waits for input.
+	auto& frameScheduler = Utility<FrameScheduler>::get();
+	frameScheduler.allowIdle();
+	if (mTileMap->animating() || mResourceGlowVisible)
 	{
-		storageCapacity += constants::BaseStorageCapacity;
+		frameScheduler.animate(MapAnimationInterval);
 	}
 
-	const auto& structures = Utility<StructureManager>::get().structureList(structureClass);
-	for (auto structure : structures)
-	{
-		if (structure->operational() || structure->isIdle())
-		{
-			storageCapacity += capacity;
-		}
-	}
-
-	return storageCapacity;
+	return this;
 }
 
 
@@ -711,9 +714,15 @@ void MapViewState::onMouseMove(int /*x*/, int /*y*/, int /*rX*/, int /*rY*/)
  */
 void MapViewState::onMouseWheel(int /*x*/, int y)
 {
-	if (mInsertMode != InsertMode::Tube) { return; }
+	if (mInsertMode == InsertMode::Tube)
+	{
+		y > 0 ? mConnections.decrementSelection() : mConnections.incrementSelection();
+		return;
+	}
 
-	y > 0 ? mConnections.decrementSelection() : mConnections.incrementSelection();
+	if (!active() || modalUiElementDisplayed() || !mTileMap->boundingBox().contains(MOUSE_COORDS)) { return; }
+
+	mTileMap->zoomLevel(mTileMap->zoomLevel() + (y > 0 ? -1 : 1));
 }
 
 
@@ -767,7 +776,7 @@ void MapViewState::insertTube(ConnectorDir dir, int depth, Tile* tile)
 		throw std::runtime_error("MapViewState::insertTube() called with invalid ConnectorDir paramter.");
 	}
 
-	Utility<StructureManager>::get().addStructure(new Tube(dir, depth != 0), tile);
+	Utility<StructureManager>::get().addStructure(TypedPool<Tube>::create(dir, depth != 0), tile);
 }
 
 
@@ -909,13 +918,13 @@ void MapViewState::placeRobodozer(Tile& tile)
 		}
 
 		mMineOperationsWindow.hide();
-		mTileMap->removeMineLocation(mTileMap->tileMouseHover());
-		tile.pushMine(nullptr);
+		// The MineFacility listens to the Mine so it has to be removed before the Mine is deleted
 		for (int i = 0; i <= mTileMap->maxDepth(); ++i)
 		{
 			auto& mineShaftTile = mTileMap->getTile(mTileMap->tileMouseHover(), i);
 			Utility<StructureManager>::get().removeStructure(mineShaftTile.structure());
 		}
+		mTileMap->removeMineLocation(mTileMap->tileMouseHover());
 	}
 	else if (tile.thingIsStructure())
 	{
@@ -1113,6 +1122,9 @@ void MapViewState::placeRobot()
 	default:
 		break;
 	}
+
+	// Robots, mines and comm towers can all change when a robot is placed
+	mMiniMapLayerDirty = true;
 }
 
 
@@ -1187,7 +1199,7 @@ void MapViewState::placeStructure()
 	{
 		if (!validLanderSite(*tile)) { return; }
 
-		ColonistLander* s = new ColonistLander(tile);
+		ColonistLander* s = TypedPool<ColonistLander>::create(tile);
 		s->deploySignal().connect(this, &MapViewState::onDeployColonistLander);
 		Utility<StructureManager>::get().addStructure(s, tile);
 
@@ -1203,7 +1215,7 @@ void MapViewState::placeStructure()
 	{
 		if (!validLanderSite(*tile)) { return; }
 
-		CargoLander* cargoLander = new CargoLander(tile);
+		CargoLander* cargoLander = TypedPool<CargoLander>::create(tile);
 		cargoLander->deploySignal().connect(this, &MapViewState::onDeployCargoLander);
 		Utility<StructureManager>::get().addStructure(cargoLander, tile);
 
@@ -1235,13 +1247,6 @@ void MapViewState::placeStructure()
 
 		Utility<StructureManager>::get().addStructure(structure, tile);
 
-		// FIXME: Ugly
-		if (structure->isFactory())
-		{
-			static_cast<Factory*>(structure)->productionComplete().connect(this, &MapViewState::onFactoryProductionComplete);
-			static_cast<Factory*>(structure)->resourcePool(&mResourcesCount);
-		}
-
 		if (structure->structureId() == StructureID::SID_MAINTENANCE_FACILITY)
 		{
 			static_cast<MaintenanceFacility*>(structure)->resources(mResourcesCount);
@@ -1270,7 +1275,7 @@ void MapViewState::insertSeedLander(NAS2D::Point<int> point)
 			return;
 		}
 
-		SeedLander* s = new SeedLander(point);
+		SeedLander* s = TypedPool<SeedLander>::create(point);
 		s->deploySignal().connect(this, &MapViewState::onDeploySeedLander);
 		Utility<StructureManager>::get().addStructure(s, &mTileMap->getTile(point)); // Can only ever be placed on depth level 0
 
@@ -1328,16 +1333,15 @@ void MapViewState::updateRobots()
 				tile->removeThing();
 			}
 
-			for (auto rcc : Utility<StructureManager>::get().getStructures<RobotCommand>())
+			if (robot->robotCommand())
 			{
-				rcc->removeRobot(robot);
+				robot->robotCommand()->removeRobot(robot);
 			}
 
 			if (mRobotInspector.focusedRobot() == robot) { mRobotInspector.hide(); }
 
-			mRobotPool.erase(robot);
-			delete robot;
 			robot_it = mRobotList.erase(robot_it);
+			mRobotPool.erase(robot);
 		}
 		else if (robot->idle())
 		{
@@ -1353,6 +1357,8 @@ void MapViewState::updateRobots()
 				checkRobotSelectionInterface(robot->type());
 				robot->reset();
 			}
+
+			mRobotPool.releaseRobot(robot);
 		}
 		else
 		{
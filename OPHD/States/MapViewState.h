@@ -8,6 +8,7 @@
 #include "Planet.h"
 #include "Route.h"
 
+#include "../Cache.h"
 #include "../Common.h"
 #include "../Constants.h"
 #include "../StorableResources.h"
@@ -19,12 +20,15 @@
 #include "../UI/Gui.h"
 #include "../UI/NotificationArea.h"
 #include "../UI/NotificationWindow.h"
+#include "../UI/TextLayoutCache.h"
 #include "../UI/UI.h"
 
 #include <NAS2D/Signal/Signal.h>
 #include <NAS2D/Renderer/Point.h>
 #include <NAS2D/Renderer/Rectangle.h>
 
+#include <array>
+#include <future>
 #include <string>
 #include <memory>
 
@@ -93,6 +97,9 @@ public:
 	Difficulty difficulty() { return mDifficulty; }
 	void difficulty(Difficulty difficulty);
 
+	int populationSize() const { return mPopulation.size(); }
+	void processTurn();
+
 protected:
 	void initialize() override;
 	State* update() override;
@@ -119,6 +126,7 @@ private:
 	// DRAWING FUNCTIONS
 	void drawUI();
 	void drawMiniMap();
+	void updateMiniMapLayer();
 	void drawNavInfo();
 	bool drawNavIcon(NAS2D::Renderer& renderer, const NAS2D::Rectangle<int>& currentIconBounds, const NAS2D::Rectangle<int>& subImageBounds, const NAS2D::Color& iconColor, const NAS2D::Color& iconHighlightColor);
 
@@ -149,7 +157,6 @@ private:
 	void countFood();
 	void transferFoodToCommandCenter();
 	int refinedResourcesInStorage();
-	int totalStorage(Structure::StructureClass, int);
 
 	void setMinimapView();
 
@@ -162,7 +169,7 @@ private:
 	void changeViewDepth(int);
 
 	void pullRobotFromFactory(ProductType pt, Factory& factory);
-	void onFactoryProductionComplete(Factory& factory);
+	void moveFactoryProduct(Factory& factory);
 
 	void onMineFacilityExtend(MineFacility* mf);
 
@@ -180,6 +187,7 @@ private:
 	void updateResources();
 	void updateRoads();
 	void updateRobots();
+	void updateFactoryProduction();
 
 	void findMineRoutes();
 	void transportOreFromMines();
@@ -191,6 +199,7 @@ private:
 	// SAVE GAME MANAGEMENT FUNCTIONS
 	void readRobots(NAS2D::Xml::XmlElement* element);
 	void readStructures(NAS2D::Xml::XmlElement* element);
+	void readStructureElements(NAS2D::Xml::XmlElement* element, const std::unordered_map<int, Robot*>& robotsById, std::vector<std::pair<Structure*, Tile*>>& structures);
 	void readTurns(NAS2D::Xml::XmlElement* element);
 	void readPopulation(NAS2D::Xml::XmlElement* element);
 	void readMoraleChanges(NAS2D::Xml::XmlElement*);
@@ -258,8 +267,9 @@ private:
 
 	Planet::Attributes mPlanetAttributes;
 	Difficulty mDifficulty = Difficulty::Medium;
+	std::future<void> mStructureCatalogueInit; /**< Fills in the StructureCatalogue on a worker while a new game's map is built. */
 
-	const NAS2D::Image mUiIcons{"ui/icons.png"}; /**< User interface icons. */
+	const AtlasImage& mUiIcons{uiAtlas.image("ui/icons.png")}; /**< User interface icons. */
 	const NAS2D::Image mBackground{"sys/bg1.png"}; /**< Background image drawn behind the tile map. */
 	std::unique_ptr<NAS2D::Image> mMapDisplay; /**< Satellite view of the Site Map. */
 	std::unique_ptr<NAS2D::Image> mHeightMap; /**< Height view of the Site Map. */
@@ -356,6 +366,12 @@ private:
 	std::vector<TileList> mPoliceOverlays;
 	TileList mTruckRouteOverlay;
 
+	std::unique_ptr<NAS2D::Image> mMiniMapLayer; /**< Comm ranges, mines, routes and robots drawn over the site map. */
+	bool mMiniMapLayerDirty = true; /**< Set when anything on mMiniMapLayer changes. */
+
+	std::array<ValueText, 8> mResourceInfoText; /**< Resource bar values, in the order they're drawn. */
+	bool mResourceGlowVisible = false; /**< A low resource count glowed in the last frame drawn. */
+
 	NAS2D::Point<int> mTubeStart;
 	bool mPlacingTube = false;
 
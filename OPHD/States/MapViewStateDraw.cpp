@@ -6,6 +6,7 @@
 
 #include "../Constants.h"
 #include "../Cache.h"
+#include "../ColonyStatistics.h"
 #include "../Mine.h"
 #include "../StructureManager.h"
 #include "../Map/TileMap.h"
@@ -13,6 +14,8 @@
 #include <NAS2D/Utility.h>
 #include <NAS2D/Renderer/Renderer.h>
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -46,6 +49,87 @@ namespace {
 		}
 		return static_cast<uint8_t>(glowStep);
 	}
+
+
+	/**
+	 * RGBA pixel buffer the minimap's layer is composed in, one pixel per
+	 * tile. Anything that reaches past its edges is clipped.
+	 */
+	class MiniMapLayerPixels
+	{
+	public:
+		explicit MiniMapLayerPixels(NAS2D::Vector<int> size) :
+			mSize{size},
+			mPixels(static_cast<std::size_t>(size.x * size.y) * 4, 0)
+		{}
+
+		void set(NAS2D::Point<int> position, NAS2D::Color color)
+		{
+			if (!contains(position)) { return; }
+
+			auto* pixel = &mPixels[offset(position)];
+			pixel[0] = color.red;
+			pixel[1] = color.green;
+			pixel[2] = color.blue;
+			pixel[3] = color.alpha;
+		}
+
+		void fill(const NAS2D::Rectangle<int>& rect, NAS2D::Color color)
+		{
+			for (int y = rect.y; y < rect.y + rect.height; ++y)
+			{
+				for (int x = rect.x; x < rect.x + rect.width; ++x)
+				{
+					set({x, y}, color);
+				}
+			}
+		}
+
+		/**
+		 * Blends part of an atlas image over the buffer the same way
+		 * drawSubImage() would over the screen.
+		 */
+		void blend(const AtlasImage& image, NAS2D::Point<int> position, const NAS2D::Rectangle<int>& subImageRect)
+		{
+			for (int y = 0; y < subImageRect.height; ++y)
+			{
+				for (int x = 0; x < subImageRect.width; ++x)
+				{
+					const auto destination = position + NAS2D::Vector{x, y};
+					if (!contains(destination)) { continue; }
+
+					const auto color = image.image->pixelColor(NAS2D::Point{subImageRect.x + x, subImageRect.y + y} + image.offset);
+					const int alpha = color.alpha;
+					const int inverse = 255 - alpha;
+
+					auto* pixel = &mPixels[offset(destination)];
+					pixel[0] = static_cast<std::uint8_t>((color.red * alpha + pixel[0] * inverse) / 255);
+					pixel[1] = static_cast<std::uint8_t>((color.green * alpha + pixel[1] * inverse) / 255);
+					pixel[2] = static_cast<std::uint8_t>((color.blue * alpha + pixel[2] * inverse) / 255);
+					pixel[3] = static_cast<std::uint8_t>(alpha + pixel[3] * inverse / 255);
+				}
+			}
+		}
+
+		std::unique_ptr<NAS2D::Image> image()
+		{
+			return std::make_unique<NAS2D::Image>(mPixels.data(), 4, mSize);
+		}
+
+	private:
+		bool contains(NAS2D::Point<int> position) const
+		{
+			return position.x >= 0 && position.y >= 0 && position.x < mSize.x && position.y < mSize.y;
+		}
+
+		std::size_t offset(NAS2D::Point<int> position) const
+		{
+			return static_cast<std::size_t>(position.y * mSize.x + position.x) * 4;
+		}
+
+		NAS2D::Vector<int> mSize;
+		std::vector<std::uint8_t> mPixels;
+	};
 }
 
 
@@ -61,14 +145,39 @@ void MapViewState::drawMiniMap()
 	bool isHeightmapToggled = mBtnToggleHeightmap.toggled();
 	renderer.drawImage(*(isHeightmapToggled ? mHeightMap : mMapDisplay).get(), miniMapBoxFloat.startPoint());
 
+	if (mMiniMapLayerDirty) { updateMiniMapLayer(); }
+	renderer.drawImage(*mMiniMapLayer, miniMapBoxFloat.startPoint());
+
 	const auto miniMapOffset = mMiniMapBoundingBox.startPoint() - NAS2D::Point{0, 0};
+	const auto& viewLocation = mTileMap->mapViewLocation();
+	const auto edgeLength = mTileMap->edgeLength();
+	const auto viewBoxSize = NAS2D::Vector{edgeLength, edgeLength};
+	const auto viewBoxPosition = viewLocation + miniMapOffset;
+
+	renderer.drawBox(NAS2D::Rectangle<int>::Create(viewBoxPosition + NAS2D::Vector{1, 1}, viewBoxSize), NAS2D::Color{0, 0, 0, 180});
+	renderer.drawBox(NAS2D::Rectangle<int>::Create(viewBoxPosition, viewBoxSize), NAS2D::Color::White);
+
+	renderer.clipRectClear();
+}
+
+
+/**
+ * Rebuilds the image of everything drawn over the site map.
+ *
+ * Comm ranges, mines, routes and robots are composed one pixel per tile
+ * into a buffer and uploaded as a single image, so drawing the minimap
+ * takes one draw call however much is on it. Only needs to be done when
+ * one of them changes, which sets mMiniMapLayerDirty.
+ */
+void MapViewState::updateMiniMapLayer()
+{
+	MiniMapLayerPixels layer{mTileMap->size()};
+
 	const auto ccPosition = ccLocation();
 	if (ccPosition != CcNotPlaced)
 	{
-		const auto ccOffsetPosition = ccPosition + miniMapOffset;
 		const auto ccCommRangeImageRect = NAS2D::Rectangle{166, 226, 30, 30};
-		renderer.drawSubImage(mUiIcons, ccOffsetPosition - ccCommRangeImageRect.size() / 2, ccCommRangeImageRect);
-		renderer.drawBoxFilled(NAS2D::Rectangle<int>::Create(ccOffsetPosition - NAS2D::Vector{1, 1}, NAS2D::Vector{3, 3}), NAS2D::Color::White);
+		layer.blend(mUiIcons, ccPosition - ccCommRangeImageRect.size() / 2, ccCommRangeImageRect);
 	}
 
 	auto& structureManager = NAS2D::Utility<StructureManager>::get();
@@ -78,10 +187,15 @@ void MapViewState::drawMiniMap()
 		{
 			const auto commTowerPosition = structureManager.tileFromStructure(commTower).position();
 			const auto commTowerRangeImageRect = NAS2D::Rectangle{146, 236, 20, 20};
-			renderer.drawSubImage(mUiIcons, commTowerPosition + miniMapOffset - commTowerRangeImageRect.size() / 2, commTowerRangeImageRect);
+			layer.blend(mUiIcons, commTowerPosition - commTowerRangeImageRect.size() / 2, commTowerRangeImageRect);
 		}
 	}
 
+	if (ccPosition != CcNotPlaced)
+	{
+		layer.fill(NAS2D::Rectangle<int>::Create(ccPosition - NAS2D::Vector{1, 1}, NAS2D::Vector{3, 3}), NAS2D::Color::White);
+	}
+
 	for (auto minePosition : mTileMap->mineLocations())
 	{
 		Mine* mine = mTileMap->getTile(minePosition, 0).mine();
@@ -93,36 +207,25 @@ void MapViewState::drawMiniMap()
 		else { mineBeaconStatusOffsetX = 16; }
 
 		const auto mineImageRect = NAS2D::Rectangle{mineBeaconStatusOffsetX, 0, 7, 7};
-		renderer.drawSubImage(mUiIcons, minePosition + miniMapOffset - NAS2D::Vector{2, 2}, mineImageRect);
+		layer.blend(mUiIcons, minePosition - NAS2D::Vector{2, 2}, mineImageRect);
 	}
 
-	// Temporary debug aid, will be slow with high numbers of mines
-	// especially with routes of longer lengths.
-	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
-	for (auto route : routeTable)
+	auto& routeTable = NAS2D::Utility<RouteTable>::get();
+	for (const auto& [mineFacility, route] : routeTable)
 	{
-		for (auto tile : route.second.path)
+		for (auto tile : route.path)
 		{
-			const auto tilePosition = static_cast<Tile*>(tile)->position();
-			renderer.drawPoint(tilePosition + miniMapOffset, NAS2D::Color::Magenta);
+			layer.set(static_cast<Tile*>(tile)->position(), NAS2D::Color::Magenta);
 		}
 	}
 
 	for (auto robotEntry : mRobotList)
 	{
-		const auto robotPosition = robotEntry.second->position();
-		renderer.drawPoint(robotPosition + miniMapOffset, NAS2D::Color::Cyan);
+		layer.set(robotEntry.second->position(), NAS2D::Color::Cyan);
 	}
 
-	const auto& viewLocation = mTileMap->mapViewLocation();
-	const auto edgeLength = mTileMap->edgeLength();
-	const auto viewBoxSize = NAS2D::Vector{edgeLength, edgeLength};
-	const auto viewBoxPosition = viewLocation + miniMapOffset;
-
-	renderer.drawBox(NAS2D::Rectangle<int>::Create(viewBoxPosition + NAS2D::Vector{1, 1}, viewBoxSize), NAS2D::Color{0, 0, 0, 180});
-	renderer.drawBox(NAS2D::Rectangle<int>::Create(viewBoxPosition, viewBoxSize), NAS2D::Color::White);
-
-	renderer.clipRectClear();
+	mMiniMapLayer = layer.image();
+	mMiniMapLayerDirty = false;
 }
 
 
@@ -146,11 +249,12 @@ void MapViewState::drawResourceInfo()
 	const auto unpinnedImageRect = NAS2D::Rectangle{ 0, 72, 8, 8 };
 	const auto pinnedImageRect = NAS2D::Rectangle{ 8, 72, 8, 8 };
 
-	renderer.drawSubImage(mUiIcons, NAS2D::Point{ 2, 7 }, mPinResourcePanel ? unpinnedImageRect : pinnedImageRect);
-	renderer.drawSubImage(mUiIcons, NAS2D::Point{ 675, 7 }, mPinPopulationPanel ? unpinnedImageRect : pinnedImageRect);
+	drawSubImage(renderer, mUiIcons, NAS2D::Point{ 2, 7 }, mPinResourcePanel ? unpinnedImageRect : pinnedImageRect);
+	drawSubImage(renderer, mUiIcons, NAS2D::Point{ 675, 7 }, mPinPopulationPanel ? unpinnedImageRect : pinnedImageRect);
 
 	const auto glowIntensity = calcGlowIntensity();
 	const auto glowColor = NAS2D::Color{ 255, glowIntensity, glowIntensity };
+	mResourceGlowVisible = false;
 
 	constexpr auto iconSize = constants::ResourceIconSize;
 	const std::array resources
@@ -161,30 +265,34 @@ void MapViewState::drawResourceInfo()
 		std::tuple{NAS2D::Rectangle{112, 16, iconSize, iconSize}, mResourcesCount.resources[3], 0},
 	};
 
+	auto resourceInfoText = mResourceInfoText.begin();
 	for (const auto& [imageRect, amount, spacing] : resources)
 	{
-		renderer.drawSubImage(mUiIcons, position, imageRect);
+		drawSubImage(renderer, mUiIcons, position, imageRect);
 		const auto color = (amount <= 10) ? glowColor : NAS2D::Color::White;
-		renderer.drawText(*MAIN_FONT, std::to_string(amount), position + textOffset, color);
+		mResourceGlowVisible = mResourceGlowVisible || amount <= 10;
+		renderer.drawText(*MAIN_FONT, (resourceInfoText++)->format(amount), position + textOffset, color);
 		position.x += spacing;
 	}
 
 	// Capacity (Storage, Food, Energy)
 	const auto& sm = NAS2D::Utility<StructureManager>::get();
+	const auto& colonyTotals = NAS2D::Utility<ColonyStatistics>::get().totals();
+	const auto refinedResources = refinedResourcesInStorage();
 	const std::array storageCapacities
 	{
-		std::tuple{NAS2D::Rectangle{96, 32, iconSize, iconSize}, refinedResourcesInStorage(), totalStorage(Structure::StructureClass::Storage, 1000), totalStorage(Structure::StructureClass::Storage, 1000) - refinedResourcesInStorage() <= 100},
-		std::tuple{NAS2D::Rectangle{64, 32, iconSize, iconSize}, mFood, totalStorage(Structure::StructureClass::FoodProduction, 1000), mFood <= 10},
+		std::tuple{NAS2D::Rectangle{96, 32, iconSize, iconSize}, refinedResources, colonyTotals.storageCapacity, colonyTotals.storageCapacity - refinedResources <= 100},
+		std::tuple{NAS2D::Rectangle{64, 32, iconSize, iconSize}, mFood, colonyTotals.foodStorageCapacity, mFood <= 10},
 		std::tuple{NAS2D::Rectangle{80, 32, iconSize, iconSize}, sm.totalEnergyAvailable(), sm.totalEnergyProduction(), sm.totalEnergyAvailable() <= 5}
 	};
 
 	position.x += x + offsetX;
 	for (const auto& [imageRect, parts, total, isHighlighted] : storageCapacities)
 	{
-		renderer.drawSubImage(mUiIcons, position, imageRect);
+		drawSubImage(renderer, mUiIcons, position, imageRect);
 		const auto color = isHighlighted ? glowColor : NAS2D::Color::White;
-		const auto text = std::to_string(parts) + "/" + std::to_string(total);
-		renderer.drawText(*MAIN_FONT, text, position + textOffset, color);
+		mResourceGlowVisible = mResourceGlowVisible || isHighlighted;
+		renderer.drawText(*MAIN_FONT, (resourceInfoText++)->format(parts, total), position + textOffset, color);
 		position.x += (x + offsetX) * 2;
 	}
 
@@ -193,14 +301,14 @@ void MapViewState::drawResourceInfo()
 	position.y += 4;
 	int popMoraleDeltaImageOffsetX = mCurrentMorale < mPreviousMorale ? 0 : (mCurrentMorale > mPreviousMorale ? 8 : 16);
 	const auto popMoraleDirectionImageRect = NAS2D::Rectangle{ popMoraleDeltaImageOffsetX, 64, 8, 8 };
-	renderer.drawSubImage(mUiIcons, position, popMoraleDirectionImageRect);
+	drawSubImage(renderer, mUiIcons, position, popMoraleDirectionImageRect);
 
 	position.x += 13;
 	position.y -= 4;
 	const auto moraleLevel = (std::clamp(mCurrentMorale, 1, 999) / 200);
 	const auto popMoraleImageRect = NAS2D::Rectangle{ 176 + moraleLevel * constants::ResourceIconSize, 0, constants::ResourceIconSize, constants::ResourceIconSize };
-	renderer.drawSubImage(mUiIcons, position, popMoraleImageRect);
-	renderer.drawText(*MAIN_FONT, std::to_string(mPopulation.size()), position + textOffset, NAS2D::Color::White);
+	drawSubImage(renderer, mUiIcons, position, popMoraleImageRect);
+	renderer.drawText(*MAIN_FONT, resourceInfoText->format(mPopulation.size()), position + textOffset, NAS2D::Color::White);
 
 	bool isMouseInPopPanel = NAS2D::Rectangle{ 675, 1, 75, 19 }.contains(MOUSE_COORDS);
 	bool shouldShowPopPanel = mPinPopulationPanel || isMouseInPopPanel;
@@ -213,14 +321,14 @@ void MapViewState::drawResourceInfo()
 	// Turns
 	position.x = renderer.size().x - 80;
 	const auto turnImageRect = NAS2D::Rectangle{ 128, 0, constants::ResourceIconSize, constants::ResourceIconSize };
-	renderer.drawSubImage(mUiIcons, position, turnImageRect);
+	drawSubImage(renderer, mUiIcons, position, turnImageRect);
 	renderer.drawText(*MAIN_FONT, std::to_string(mTurnCount), position + textOffset, NAS2D::Color::White);
 
 	position = mTooltipSystemButton.rect().startPoint() + NAS2D::Vector{ constants::MarginTight, constants::MarginTight };
 	bool isMouseInMenu = mTooltipSystemButton.rect().contains(MOUSE_COORDS);
 	int menuGearHighlightOffsetX = isMouseInMenu ? 144 : 128;
 	const auto menuImageRect = NAS2D::Rectangle{ menuGearHighlightOffsetX, 32, constants::ResourceIconSize, constants::ResourceIconSize };
-	renderer.drawSubImage(mUiIcons, position, menuImageRect);
+	drawSubImage(renderer, mUiIcons, position, menuImageRect);
 }
 
 
@@ -244,15 +352,15 @@ void MapViewState::drawRobotInfo()
 	const auto robotSummaryImageRect = NAS2D::Rectangle{231, 43, 25, 25};
 
 	const std::array icons{
-		std::tuple{minerImageRect, mRobotPool.getAvailableCount(Robot::Type::Miner), mRobotPool.miners().size()},
-		std::tuple{dozerImageRect, mRobotPool.getAvailableCount(Robot::Type::Dozer), mRobotPool.dozers().size()},
-		std::tuple{diggerImageRect, mRobotPool.getAvailableCount(Robot::Type::Digger), mRobotPool.diggers().size()},
+		std::tuple{minerImageRect, mRobotPool.getAvailableCount(Robot::Type::Miner), mRobotPool.robotCount(Robot::Type::Miner)},
+		std::tuple{dozerImageRect, mRobotPool.getAvailableCount(Robot::Type::Dozer), mRobotPool.robotCount(Robot::Type::Dozer)},
+		std::tuple{diggerImageRect, mRobotPool.getAvailableCount(Robot::Type::Digger), mRobotPool.robotCount(Robot::Type::Digger)},
 		std::tuple{robotSummaryImageRect, static_cast<int>(mRobotPool.currentControlCount()), static_cast<std::size_t>(mRobotPool.robotControlMax())},
 	};
 
 	for (const auto& [imageRect, parts, total] : icons)
 	{
-		renderer.drawSubImage(mUiIcons, position, imageRect);
+		drawSubImage(renderer, mUiIcons, position, imageRect);
 		const auto text = std::to_string(parts) + "/" + std::to_string(total);
 		renderer.drawText(*MAIN_FONT, text, position + textOffset, NAS2D::Color::White);
 		position.y -= 25;
@@ -262,7 +370,7 @@ void MapViewState::drawRobotInfo()
 bool MapViewState::drawNavIcon(NAS2D::Renderer& renderer, const NAS2D::Rectangle<int>& currentIconBounds, const NAS2D::Rectangle<int>& subImageBounds, const NAS2D::Color& iconColor, const NAS2D::Color& iconHighlightColor) {
 	bool isMouseInIcon = currentIconBounds.contains(MOUSE_COORDS);
 	NAS2D::Color color = isMouseInIcon ? iconHighlightColor : iconColor;
-	renderer.drawSubImage(mUiIcons, currentIconBounds.startPoint(), subImageBounds, color);
+	drawSubImage(renderer, mUiIcons, currentIconBounds.startPoint(), subImageBounds, color);
 	return isMouseInIcon;
 }
 
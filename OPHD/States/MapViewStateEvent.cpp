@@ -60,9 +60,9 @@ void MapViewState::pullRobotFromFactory(ProductType pt, Factory& factory)
 
 
 /**
- * Called whenever a Factory's production is complete.
+ * Moves a Factory's finished product into a warehouse, or out as a robot.
  */
-void MapViewState::onFactoryProductionComplete(Factory& factory)
+void MapViewState::moveFactoryProduct(Factory& factory)
 {
 	switch (factory.productWaiting())
 	{
@@ -139,21 +139,20 @@ void MapViewState::onDeploySeedLander(NAS2D::Point<int> point)
 	// Place initial tubes
 	for (const auto& direction : DirectionClockwise4)
 	{
-		structureManager.addStructure(new Tube(ConnectorDir::CONNECTOR_INTERSECTION, false), &mTileMap->getTile(point + direction));
+		structureManager.addStructure(TypedPool<Tube>::create(ConnectorDir::CONNECTOR_INTERSECTION, false), &mTileMap->getTile(point + direction));
 	}
 
 	// TOP ROW
-	structureManager.addStructure(new SeedPower(), &mTileMap->getTile(point + DirectionNorthWest));
+	structureManager.addStructure(TypedPool<SeedPower>::create(), &mTileMap->getTile(point + DirectionNorthWest));
 
 	CommandCenter* cc = static_cast<CommandCenter*>(StructureCatalogue::get(StructureID::SID_COMMAND_CENTER));
 	cc->sprite().setFrame(3);
 	structureManager.addStructure(cc, &mTileMap->getTile(point + DirectionNorthEast));
 	ccLocation() = point + DirectionNorthEast;
+	mMiniMapLayerDirty = true;
 
 	// BOTTOM ROW
 	SeedFactory* sf = static_cast<SeedFactory*>(StructureCatalogue::get(StructureID::SID_SEED_FACTORY));
-	sf->resourcePool(&mResourcesCount);
-	sf->productionComplete().connect(this, &MapViewState::onFactoryProductionComplete);
 	sf->sprite().setFrame(7);
 	structureManager.addStructure(sf, &mTileMap->getTile(point + DirectionSouthWest));
 
@@ -205,11 +204,11 @@ void MapViewState::onDiggerTaskComplete(Robot* robot)
 	{
 		++newDepth;
 
-		AirShaft* as1 = new AirShaft();
+		AirShaft* as1 = TypedPool<AirShaft>::create();
 		if (t->depth() > 0) { as1->ug(); }
 		NAS2D::Utility<StructureManager>::get().addStructure(as1, t);
 
-		AirShaft* as2 = new AirShaft();
+		AirShaft* as2 = TypedPool<AirShaft>::create();
 		as2->ug();
 		NAS2D::Utility<StructureManager>::get().addStructure(as2, &mTileMap->getTile(origin, newDepth));
 
@@ -261,14 +260,14 @@ void MapViewState::onMinerTaskComplete(Robot* robot)
 	auto& robotTile = *mRobotList[robot];
 
 	// Surface structure
-	MineFacility* mineFacility = new MineFacility(robotTile.mine());
+	MineFacility* mineFacility = TypedPool<MineFacility>::create(robotTile.mine());
 	mineFacility->maxDepth(mTileMap->maxDepth());
 	NAS2D::Utility<StructureManager>::get().addStructure(mineFacility, &robotTile);
 	mineFacility->extensionComplete().connect(this, &MapViewState::onMineFacilityExtend);
 
 	// Tile immediately underneath facility.
 	auto& tileBelow = mTileMap->getTile(robotTile.position(), robotTile.depth() + 1);
-	NAS2D::Utility<StructureManager>::get().addStructure(new MineShaft(), &tileBelow);
+	NAS2D::Utility<StructureManager>::get().addStructure(TypedPool<MineShaft>::create(), &tileBelow);
 
 	robotTile.index(TerrainType::Dozed);
 	tileBelow.index(TerrainType::Dozed);
@@ -284,7 +283,7 @@ void MapViewState::onMineFacilityExtend(MineFacility* mineFacility)
 
 	auto& mineFacilityTile = NAS2D::Utility<StructureManager>::get().tileFromStructure(mineFacility);
 	auto& mineDepthTile = mTileMap->getTile(mineFacilityTile.position(), mineFacility->mine()->depth());
-	NAS2D::Utility<StructureManager>::get().addStructure(new MineShaft(), &mineDepthTile);
+	NAS2D::Utility<StructureManager>::get().addStructure(TypedPool<MineShaft>::create(), &mineDepthTile);
 	mineDepthTile.index(TerrainType::Dozed);
 	mineDepthTile.excavated(true);
 }
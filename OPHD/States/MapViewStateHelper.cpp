@@ -212,10 +212,13 @@ void deleteRobotsInRCC(Robot* robotToDelete, RobotCommand* rcc, RobotPool& robot
 		return;
 	}
 
-	const RobotList& rl = rcc->robots();
+	// Copied since removing robots from the facility changes its list
+	const RobotList rl = rcc->robots();
 
 	for (auto robot : rl)
 	{
+		rcc->removeRobot(robot);
+
 		if (rtt.find(robot) != rtt.end())
 		{
 			robot->die();
@@ -223,7 +226,6 @@ void deleteRobotsInRCC(Robot* robotToDelete, RobotCommand* rcc, RobotPool& robot
 		}
 
 		robotPool.erase(robot);
-		delete robot;
 	}
 }
 
@@ -333,20 +335,8 @@ bool isPointInRange(NAS2D::Point<int> point1, NAS2D::Point<int> point2, int dist
  */
 Warehouse* getAvailableWarehouse(ProductType type, std::size_t count)
 {
-	for (auto warehouse : NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>())
-	{
-		if (!warehouse->operational())
-		{
-			continue;
-		}
-
-		if (warehouse->products().canStore(type, static_cast<int>(count)))
-		{
-			return warehouse;
-		}
-	}
-
-	return nullptr;
+	const auto storageNeeded = storageRequiredPerUnit(type) * static_cast<int>(count);
+	return NAS2D::Utility<StructureManager>::get().warehouseIndex().findOperationalStorage(storageNeeded);
 }
 
 
@@ -383,25 +373,8 @@ RobotCommand* getAvailableRobotCommand()
  */
 bool simulateMoveProducts(Warehouse* sourceWarehouse)
 {
-	ProductPool sourcePool = sourceWarehouse->products();
-	const auto& warehouses = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouses)
-	{
-		if (warehouse->operational())
-		{
-			if (warehouse != sourceWarehouse)
-			{
-				ProductPool destinationPool = warehouse->products();
-				sourcePool.transferAllTo(destinationPool);
-				if (sourcePool.empty())
-				{
-					return true;
-				}
-			}
-		}
-	}
-
-	if (sourcePool.empty())
+	WarehouseIndex::TransferPlan plan;
+	if (NAS2D::Utility<StructureManager>::get().warehouseIndex().planTransferFrom(*sourceWarehouse, plan))
 	{
 		return true;
 	}
@@ -415,16 +388,13 @@ bool simulateMoveProducts(Warehouse* sourceWarehouse)
  */
 void moveProducts(Warehouse* sourceWarehouse)
 {
-	const auto& warehouses = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouses)
+	WarehouseIndex::TransferPlan plan;
+	NAS2D::Utility<StructureManager>::get().warehouseIndex().planTransferFrom(*sourceWarehouse, plan);
+
+	for (const auto& transfer : plan)
 	{
-		if (warehouse->operational())
-		{
-			if (warehouse != sourceWarehouse)
-			{
-				sourceWarehouse->products().transferAllTo(warehouse->products());
-			}
-		}
+		transfer.destination->products().store(transfer.type, transfer.count);
+		sourceWarehouse->products().pull(transfer.type, transfer.count);
 	}
 }
 
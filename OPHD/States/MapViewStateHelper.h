@@ -11,6 +11,8 @@
 
 #include "../Common.h"
 
+#include <unordered_map>
+
 
 namespace NAS2D {
 	namespace Xml {
@@ -26,7 +28,7 @@ class RobotPool;
 class Robot;
 struct StorableResources;
 
-using RobotTileTable = std::map<Robot*, Tile*>;
+using RobotTileTable = std::unordered_map<Robot*, Tile*>;
 
 extern const NAS2D::Point<int> CcNotPlaced;
 NAS2D::Point<int>& ccLocation();
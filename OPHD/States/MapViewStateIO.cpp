@@ -9,8 +9,10 @@
 #include "../Cache.h"
 #include "../Constants.h"
 #include "../IOHelper.h"
+#include "../SavegameInfo.h"
 #include "../StructureCatalogue.h"
 #include "../StructureManager.h"
+#include "../StructureSchema.h"
 #include "../Map/TileMap.h"
 #include "../XmlSerializer.h"
 
@@ -21,8 +23,10 @@
 #include <NAS2D/Xml/XmlMemoryBuffer.h>
 #include <NAS2D/ParserHelper.h>
 
+#include <future>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <stdexcept>
 #include <iostream>
@@ -54,18 +58,43 @@ static void loadResorucesFromXmlElement(NAS2D::Xml::XmlElement* element, Storabl
 }
 
 
-static void readRccRobots(std::string robotIds, RobotCommand& robotCommand, RobotPool& pool)
+static void readRccRobots(std::string robotIds, RobotCommand& robotCommand, const std::unordered_map<int, Robot*>& robotsById)
 {
 	for (const auto& string : NAS2D::split(robotIds, ','))
 	{
-		const auto robotId = NAS2D::stringTo<int>(string);
-		for (auto* robot : pool.robots())
+		const auto it = robotsById.find(NAS2D::stringTo<int>(string));
+		if (it != robotsById.end())
 		{
-			if (robot->id() == robotId)
-			{
-				robotCommand.addRobot(robot);
-				break;
-			}
+			robotCommand.addRobot(it->second);
+		}
+	}
+}
+
+
+/**
+ * Builds a coarse overview of the surface for the savegame info file.
+ *
+ * Each cell covers a square block of tiles. Structures take precedence
+ * over mines when both share a cell.
+ */
+static void buildSavegameThumbnail(TileMap& tileMap, SavegameInfo& info)
+{
+	const int cellSize = 4;
+	const auto mapSize = tileMap.size();
+
+	info.thumbnailWidth = (mapSize.x + cellSize - 1) / cellSize;
+	info.thumbnailHeight = (mapSize.y + cellSize - 1) / cellSize;
+	info.thumbnail.assign(static_cast<std::size_t>(info.thumbnailWidth * info.thumbnailHeight), SavegameInfo::ThumbnailEmpty);
+
+	for (int y = 0; y < mapSize.y; ++y)
+	{
+		for (int x = 0; x < mapSize.x; ++x)
+		{
+			auto& tile = tileMap.getTile({x, y}, TileMap::TileMapLevel::LEVEL_SURFACE);
+			auto& cell = info.thumbnail[static_cast<std::size_t>((y / cellSize) * info.thumbnailWidth + x / cellSize)];
+
+			if (tile.thingIsStructure()) { cell = SavegameInfo::ThumbnailStructure; }
+			else if (tile.hasMine() && cell == SavegameInfo::ThumbnailEmpty) { cell = SavegameInfo::ThumbnailMine; }
 		}
 	}
 }
@@ -131,6 +160,15 @@ void MapViewState::save(const std::string& filePath)
 	doc.accept(&buff);
 
 	Utility<Filesystem>::get().write(filePath, buff.buffer());
+
+	SavegameInfo info;
+	info.version = constants::SaveGameVersion;
+	info.turn = mTurnCount;
+	info.population = mPopulation.size();
+	info.planet = mPlanetAttributes.name.empty() ? mPlanetAttributes.mapImagePath : mPlanetAttributes.name;
+	info.structureCount = Utility<StructureManager>::get().count();
+	buildSavegameThumbnail(*mTileMap, info);
+	writeSavegameInfo(filePath, info);
 }
 
 
@@ -144,6 +182,7 @@ XmlElement* MapViewState::serializeProperties()
 			{"diggingdepth", mPlanetAttributes.maxDepth},
 			{"meansolardistance", mPlanetAttributes.meanSolarDistance},
 			{"difficulty", difficultyString(difficulty())},
+			{"crime_seed", static_cast<int>(mCrimeRateUpdate.seed())},
 		}}
 	);
 }
@@ -188,16 +227,25 @@ void MapViewState::load(const std::string& filePath)
 	mPlanetAttributes.meanSolarDistance = dictionary.get<float>("meansolardistance");
 
 	difficulty(stringToEnum(difficultyTable, dictionary.get("difficulty", std::string{"Medium"})));
-
-	StructureCatalogue::init(mPlanetAttributes.meanSolarDistance);
-	mMapDisplay = std::make_unique<Image>(mPlanetAttributes.mapImagePath + MAP_DISPLAY_EXTENSION);
-	mHeightMap = std::make_unique<Image>(mPlanetAttributes.mapImagePath + MAP_TERRAIN_EXTENSION);
-	mTileMap = new TileMap(mPlanetAttributes.mapImagePath, mPlanetAttributes.tilesetPath, mPlanetAttributes.maxDepth, 0, Planet::Hostility::None, false);
+	// Saves from before the seed was stored all use the same seed so they still roll the same crimes on every load
+	mCrimeRateUpdate.seed(static_cast<std::uint32_t>(dictionary.get<int>("crime_seed", 0)));
+
+	// Nothing reads the catalogue until structures are read so it's filled in on a worker meanwhile
+	auto structureCatalogueInit = std::async(std::launch::async, StructureCatalogue::init, mPlanetAttributes.meanSolarDistance);
+
+	// The site map images decode on workers while the tile map is built
+	const auto displayPath = mPlanetAttributes.mapImagePath + MAP_DISPLAY_EXTENSION;
+	const auto heightMapPath = mPlanetAttributes.mapImagePath + MAP_TERRAIN_EXTENSION;
+	decodedImageCache.preload({displayPath, heightMapPath});
+	mTileMap = new TileMap(mPlanetAttributes.mapImagePath, mPlanetAttributes.tilesetPath, mPlanetAttributes.maxDepth, 0, mPlanetAttributes.mineSpacing, Planet::Hostility::None, false);
+	mMapDisplay = decodedImageCache.get(displayPath).upload();
+	mHeightMap = decodedImageCache.get(heightMapPath).upload();
+	decodedImageCache.clear();
 	mTileMap->deserialize(root);
 
 	delete mPathSolver;
 	mPathSolver = new micropather::MicroPather(mTileMap);
-	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
+	auto& routeTable = NAS2D::Utility<RouteTable>::get();
 	routeTable.clear();
 
 	/**
@@ -205,6 +253,7 @@ void MapViewState::load(const std::string& filePath)
 	 * having already been loaded in order to match up the robots in the save game to
 	 * the RCC.
 	 */
+	structureCatalogueInit.get();
 	readRobots(root->firstChildElement("robots"));
 	readStructures(root->firstChildElement("structures"));
 
@@ -265,6 +314,10 @@ void MapViewState::load(const std::string& filePath)
 	checkCommRangeOverlay();
 	checkSurfacePoliceOverlay();
 
+	// Population and products were read after the structures were added
+	Utility<StructureManager>::get().markChanged();
+	mMiniMapLayerDirty = true;
+
 	mMapChangedSignal();
 }
 
@@ -340,6 +393,43 @@ void MapViewState::readRobots(Xml::XmlElement* element)
 
 
 void MapViewState::readStructures(Xml::XmlElement* element)
+{
+	// Robots are read first so RCC's can be matched to their robots by ID
+	// without scanning the robot list for every ID.
+	std::unordered_map<int, Robot*> robotsById;
+	const auto robots = mRobotPool.robots();
+	robotsById.reserve(robots.size());
+	for (auto* robot : robots)
+	{
+		robotsById[robot->id()] = robot;
+	}
+
+	// Structures are handed to the StructureManager together once they're all
+	// read so its lists only grow once
+	std::size_t elementCount = 0;
+	for (XmlElement* structureElement = element->firstChildElement(); structureElement != nullptr; structureElement = structureElement->nextSiblingElement())
+	{
+		++elementCount;
+	}
+
+	StructureManager::StructureTileList structures;
+	structures.reserve(elementCount);
+
+	try
+	{
+		readStructureElements(element, robotsById, structures);
+	}
+	catch (...)
+	{
+		for (auto& entry : structures) { delete entry.first; }
+		throw;
+	}
+
+	Utility<StructureManager>::get().addStructures(structures);
+}
+
+
+void MapViewState::readStructureElements(Xml::XmlElement* element, const std::unordered_map<int, Robot*>& robotsById, StructureManager::StructureTileList& structures)
 {
 	for (XmlElement* structureElement = element->firstChildElement(); structureElement != nullptr; structureElement = structureElement->nextSiblingElement())
 	{
@@ -397,18 +487,6 @@ void MapViewState::readStructures(Xml::XmlElement* element)
 			mineFacility.mine(mine);
 			mineFacility.maxDepth(mTileMap->maxDepth());
 			mineFacility.extensionComplete().connect(this, &MapViewState::onMineFacilityExtend);
-
-			auto trucks = structureElement->firstChildElement("trucks");
-			if (trucks)
-			{
-				mineFacility.assignedTrucks(attributesToDictionary(*trucks).get<int>("assigned"));
-			}
-
-			auto extension = structureElement->firstChildElement("extension");
-			if (extension)
-			{
-				mineFacility.digTimeRemaining(attributesToDictionary(*extension).get<int>("turns_remaining"));
-			}
 		}
 
 		if (structureId == StructureID::SID_AIR_SHAFT && depth != 0)
@@ -421,19 +499,10 @@ void MapViewState::readStructures(Xml::XmlElement* element)
 			static_cast<SeedLander*>(&structure)->position({x, y});
 		}
 
-		if (structureId == StructureID::SID_AGRIDOME ||
-			structureId == StructureID::SID_COMMAND_CENTER)
+		StructureSchema::forEachSection(structure, [structureElement](const auto& section, auto& typedStructure)
 		{
-			auto& foodProduction = *static_cast<FoodProduction*>(&structure);
-
-			auto foodStorage = structureElement->firstChildElement("food");
-			if (foodStorage == nullptr)
-			{
-				throw std::runtime_error("MapViewState::readStructures(): FoodProduction structure saved without a food level node.");
-			}
-
-			foodProduction.foodLevel(attributesToDictionary(*foodStorage).get<int>("level"));
-		}
+			StructureSchema::read(section, *structureElement, typedStructure);
+		});
 
 		structure.age(age);
 		structure.forced_state_change(static_cast<StructureState>(state), static_cast<DisabledReason>(disabled_reason), static_cast<IdleReason>(idle_reason));
@@ -445,27 +514,9 @@ void MapViewState::readStructures(Xml::XmlElement* element)
 		loadResorucesFromXmlElement(structureElement->firstChildElement("production"), structure.production());
 		loadResorucesFromXmlElement(structureElement->firstChildElement("storage"), structure.storage());
 
-		if (structure.structureClass() == Structure::StructureClass::Residence)
-		{
-			auto waste = structureElement->firstChildElement("waste");
-			if (waste)
-			{
-				auto& residence = *static_cast<Residence*>(&structure);
-				const auto wasteDictionary = attributesToDictionary(*waste);
-				residence.wasteAccumulated(wasteDictionary.get<int>("accumulated"));
-				residence.wasteOverflow(wasteDictionary.get<int>("overflow"));
-			}
-		}
-
 		if (structure.structureClass() == Structure::StructureClass::Maintenance)
 		{
-			auto personnel = structureElement->firstChildElement("personnel");
-			if (personnel)
-			{
-				auto& maintenanceFacility = *static_cast<MaintenanceFacility*>(&structure);
-				maintenanceFacility.personnel(attributesToDictionary(*personnel).get<int>("assigned", 0));
-				maintenanceFacility.resources(mResourcesCount);
-			}
+			static_cast<MaintenanceFacility*>(&structure)->resources(mResourcesCount);
 		}
 
 		if (structure.isWarehouse())
@@ -481,8 +532,6 @@ void MapViewState::readStructures(Xml::XmlElement* element)
 			auto& factory = *static_cast<Factory*>(&structure);
 			factory.productType(static_cast<ProductType>(production_type));
 			factory.productionTurnsCompleted(production_completed);
-			factory.resourcePool(&mResourcesCount);
-			factory.productionComplete().connect(this, &MapViewState::onFactoryProductionComplete);
 		}
 
 		if (structure.isRobotCommand())
@@ -492,7 +541,7 @@ void MapViewState::readStructures(Xml::XmlElement* element)
 			{
 				const auto robotIds = attributesToDictionary(*robotsElement).get("robots");
 				auto& robotCommand = *static_cast<RobotCommand*>(&structure);
-				readRccRobots(robotIds, robotCommand, mRobotPool);
+				readRccRobots(robotIds, robotCommand, robotsById);
 			}
 		}
 
@@ -503,7 +552,7 @@ void MapViewState::readStructures(Xml::XmlElement* element)
 
 		structure.populationAvailable() = {pop0, pop1};
 
-		Utility<StructureManager>::get().addStructure(&structure, &tile);
+		structures.emplace_back(&structure, &tile);
 	}
 }
 
@@ -246,22 +246,28 @@ void MapViewState::updateMorale()
 void MapViewState::findMineRoutes()
 {
 	auto& smelterList = NAS2D::Utility<StructureManager>::get().getStructures<OreRefining>();
-	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
+	auto& routeTable = NAS2D::Utility<RouteTable>::get();
 	mPathSolver->Reset();
 	mTruckRouteOverlay.clear();
+	mMiniMapLayerDirty = true;
 
-	for (auto mine : NAS2D::Utility<StructureManager>::get().getStructures<MineFacility>())
+	// Drop routes left behind by bulldozed facilities
+	for (auto it = routeTable.begin(); it != routeTable.end();)
 	{
-		mine->mine()->checkExhausted();
+		it = it->first.get() ? std::next(it) : routeTable.erase(it);
+	}
 
+	for (auto mine : NAS2D::Utility<StructureManager>::get().getStructures<MineFacility>())
+	{
 		if (!mine->operational() && !mine->isIdle()) { continue; } // consider a different control path.
 
-		auto routeIt = routeTable.find(mine);
+		const PoolHandle<MineFacility> mineHandle{mine};
+		auto routeIt = routeTable.find(mineHandle);
 		bool findNewRoute = routeIt == routeTable.end();
 
 		if (!findNewRoute && routeObstructed(routeIt->second))
 		{
-			routeTable.erase(mine);
+			routeTable.erase(routeIt);
 			findNewRoute = true;
 		}
 
@@ -272,7 +278,7 @@ void MapViewState::findMineRoutes()
 
 			if (newRoute.empty()) { continue; } // give up and move on to the next mine
 
-			routeTable[mine] = newRoute;
+			routeTable[mineHandle] = newRoute;
 
 			for (auto tile : newRoute.path)
 			{
@@ -285,10 +291,10 @@ void MapViewState::findMineRoutes()
 
 void MapViewState::transportOreFromMines()
 {
-	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
+	auto& routeTable = NAS2D::Utility<RouteTable>::get();
 	for (auto mine : NAS2D::Utility<StructureManager>::get().getStructures<MineFacility>())
 	{
-		auto routeIt = routeTable.find(mine);
+		auto routeIt = routeTable.find(PoolHandle<MineFacility>{mine});
 		if (routeIt != routeTable.end())
 		{
 			const auto& route = routeIt->second;
@@ -337,13 +343,7 @@ void MapViewState::transportResourcesToStorage()
 		if (!smelter->operational() && !smelter->isIdle()) { continue; }
 
 		auto& stored = smelter->storage();
-		StorableResources moved
-		{
-			std::clamp(stored.resources[0], 0, 25),
-			std::clamp(stored.resources[1], 0, 25),
-			std::clamp(stored.resources[2], 0, 25),
-			std::clamp(stored.resources[3], 0, 25)
-		};
+		auto moved = stored.cap(25);
 
 		stored -= moved;
 		addRefinedResources(moved);
@@ -352,6 +352,33 @@ void MapViewState::transportResourcesToStorage()
 }
 
 
+/**
+ * Runs production for every factory then moves finished products out of
+ * them.
+ *
+ * Factories still holding a product from an earlier turn are idled for
+ * production complete after their product is moved, whether or not the
+ * move succeeded.
+ */
+void MapViewState::updateFactoryProduction()
+{
+	Factory::FactoryList productsWaiting;
+	Factory::FactoryList productsCompleted;
+	Factory::updateProduction(NAS2D::Utility<StructureManager>::get().getStructures<Factory>(), mResourcesCount, productsWaiting, productsCompleted);
+
+	for (auto factory : productsWaiting)
+	{
+		moveFactoryProduct(*factory);
+		factory->idle(IdleReason::FactoryProductionComplete);
+	}
+
+	for (auto factory : productsCompleted)
+	{
+		moveFactoryProduct(*factory);
+	}
+}
+
+
 void MapViewState::updateResources()
 {
 	findMineRoutes();
@@ -507,7 +534,7 @@ void MapViewState::updateRoads()
 			surroundingTiles[i] = mTileMap->getTile(tileToInspect).structure()->structureId() == StructureID::SID_ROAD;
 		}
 
-		road->sprite().play(IntersectionPatternTable.at(surroundingTiles));
+		road->play(IntersectionPatternTable.at(surroundingTiles));
 	}
 }
 
@@ -588,6 +615,18 @@ void MapViewState::nextTurn()
 	renderer.drawImage(*imageProcessingTurn, renderer.center() - imageProcessingTurn->size() / 2);
 	renderer.update();
 
+	processTurn();
+}
+
+
+/**
+ * Runs everything that happens at the end of a turn.
+ *
+ * \note	Doesn't draw anything so turns can be run without a frame being
+ *			shown, e.g. when benchmarking.
+ */
+void MapViewState::processTurn()
+{
 	mNotificationWindow.hide();
 	mNotificationArea.clear();
 
@@ -608,7 +647,7 @@ void MapViewState::nextTurn()
 
 	transferFoodToCommandCenter();
 
-	mCrimeRateUpdate.update(mPoliceOverlays);
+	mCrimeRateUpdate.update(mPoliceOverlays, mTurnCount);
 	auto structuresCommittingCrimes = mCrimeRateUpdate.structuresCommittingCrimes();
 	mCrimeExecution.executeCrimes(structuresCommittingCrimes);
 
@@ -627,12 +666,12 @@ void MapViewState::nextTurn()
 	updateRoads();
 
 	updateOverlays();
+	mMiniMapLayerDirty = true; // Mines, robots and comm towers change over the turn
 
-	auto& factories = NAS2D::Utility<StructureManager>::get().getStructures<Factory>();
-	for (auto factory : factories)
-	{
-		factory->updateProduction();
-	}
+	updateFactoryProduction();
+
+	// Factories move finished products into warehouses.
+	NAS2D::Utility<StructureManager>::get().markChanged();
 
 	populateStructureMenu();
 
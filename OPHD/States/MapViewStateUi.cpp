@@ -11,6 +11,7 @@
 
 #include "../Constants.h"
 #include "../DirectionOffset.h"
+#include "../StartupTimer.h"
 #include "../StructureCatalogue.h"
 #include "../StructureManager.h"
 #include "../Map/TileMap.h"
@@ -19,6 +20,7 @@
 #include <NAS2D/Renderer/Renderer.h>
 
 #include <cmath>
+#include <iostream>
 
 
 using namespace NAS2D;
@@ -603,6 +605,7 @@ void MapViewState::onDiggerSelectionDialog(Direction direction, Tile* tile)
 	Robodigger* robot = mRobotPool.getDigger();
 	robot->startTask(static_cast<int>(tile->index()) + constants::DiggerTaskTime);
 	mRobotPool.insertRobotIntoTable(mRobotList, robot, tile);
+	mMiniMapLayerDirty = true;
 
 	robot->direction(direction);
 
@@ -686,15 +689,19 @@ void MapViewState::onFileIoAction(const std::string& filePath, FileIo::FileOpera
 {
 	if (fileOp == FileIo::FileOperation::Load)
 	{
+		auto& startupTimer = NAS2D::Utility<StartupTimer>::get();
 		try
 		{
+			StartupTimer::Stage stage{"Savegame load"};
 			load(constants::SaveGamePath + filePath + ".xml");
 		}
 		catch (const std::exception& e)
 		{
+			startupTimer.report(std::cout);
 			doNonFatalErrorMessage("Load Failed", e.what());
 			return;
 		}
+		startupTimer.report(std::cout);
 	}
 	else
 	{
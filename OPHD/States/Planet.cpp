@@ -9,6 +9,7 @@
 #include <NAS2D/Renderer/Rectangle.h>
 #include <NAS2D/Xml/Xml.h>
 
+#include <future>
 #include <stdexcept>
 
 
@@ -106,27 +107,66 @@ namespace
 }
 
 
+namespace
+{
+	std::shared_future<std::vector<Planet::Attributes>> planetAttributesPreload;
+
+
+	std::vector<Planet::Attributes> readPlanetAttributes();
+}
+
+
+/**
+ * Starts parsing the planet attributes on a worker thread so they're
+ * ready by the time the planet selection screen needs them.
+ */
+void preloadPlanetAttributes()
+{
+	if (planetAttributesPreload.valid()) { return; }
+	planetAttributesPreload = std::async(std::launch::async, readPlanetAttributes).share();
+}
+
+
+/**
+ * Gets the planet attributes, waiting on the preload if one was started.
+ *
+ * \throws	Rethrows any error raised while parsing the attributes.
+ */
 std::vector<Planet::Attributes> parsePlanetAttributes()
 {
-	const std::string rootElementName("Planets");
-	auto xmlDocument = openXmlFile("planets/PlanetAttributes.xml", rootElementName);
+	if (planetAttributesPreload.valid())
+	{
+		return planetAttributesPreload.get();
+	}
+
+	return readPlanetAttributes();
+}
 
-	std::vector<Planet::Attributes> planetAttributes;
 
-	auto rootElement = xmlDocument.firstChildElement(rootElementName);
-	for (const auto* node = rootElement->iterateChildren(nullptr);
-		node != nullptr;
-		node = rootElement->iterateChildren(node))
+namespace
+{
+	std::vector<Planet::Attributes> readPlanetAttributes()
 	{
-		std::string elementName("Planet");
-		if (node->value() != elementName)
+		const std::string rootElementName("Planets");
+		auto xmlDocument = openXmlFile("planets/PlanetAttributes.xml", rootElementName);
+
+		std::vector<Planet::Attributes> planetAttributes;
+
+		auto rootElement = xmlDocument.firstChildElement(rootElementName);
+		for (const auto* node = rootElement->iterateChildren(nullptr);
+			node != nullptr;
+			node = rootElement->iterateChildren(node))
 		{
-			throw std::runtime_error(xmlDocument.value() + " missing " + elementName + " tag");
+			std::string elementName("Planet");
+			if (node->value() != elementName)
+			{
+				throw std::runtime_error(xmlDocument.value() + " missing " + elementName + " tag");
+			}
+			planetAttributes.push_back(parsePlanet(node->toElement()));
 		}
-		planetAttributes.push_back(parsePlanet(node->toElement()));
-	}
 
-	return planetAttributes;
+		return planetAttributes;
+	}
 }
 
 
@@ -162,6 +202,10 @@ namespace
 			{
 				::parseElementValue(attributes.maxMines, element);
 			}
+			else if (element->value() == "MineSpacing")
+			{
+				::parseElementValue(attributes.mineSpacing, element);
+			}
 			else if (element->value() == "MapImagePath")
 			{
 				::parseElementValue(attributes.mapImagePath, element);
@@ -40,6 +40,7 @@ public:
 		Hostility hostility = Hostility::None;
 		int maxDepth = 0;
 		int maxMines = 0;
+		int mineSpacing = 2; /**< Mines are placed farther than this many tiles apart. */
 		std::string mapImagePath;
 		std::string tilesetPath;
 		std::string name;
@@ -96,3 +97,4 @@ private:
 };
 
 std::vector<Planet::Attributes> parsePlanetAttributes();
+void preloadPlanetAttributes();
@@ -1,8 +1,14 @@
 #pragma once
 
+#include "../ObjectPool.h"
+
 #include <map>
 #include <vector>
 
+
+class MineFacility;
+
+
 struct Route
 {
 	bool empty() const { return path.empty(); }
@@ -12,3 +18,10 @@ struct Route
 };
 
 using RouteList = std::vector<Route>;
+
+/**
+ * Routes from mine facilities to smelters. Keyed by handle so a route
+ * left behind by a bulldozed facility is never picked up by a new
+ * facility built at the same address.
+ */
+using RouteTable = std::map<PoolHandle<MineFacility>, Route>;
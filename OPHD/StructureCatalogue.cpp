@@ -32,151 +32,151 @@ Structure* StructureCatalogue::get(StructureID type)
 	switch (type)
 	{
 		case StructureID::SID_AGRIDOME:
-			structure = new Agridome();
+			structure = TypedPool<Agridome>::create();
 			break;
 
 		case StructureID::SID_AIR_SHAFT:
-			structure = new AirShaft();
+			structure = TypedPool<AirShaft>::create();
 			break;
 
 		case StructureID::SID_CARGO_LANDER: // only here for loading games
-			structure = new CargoLander(nullptr);
+			structure = TypedPool<CargoLander>::create(nullptr);
 			break;
 
 		case StructureID::SID_CHAP:
-			structure = new CHAP();
+			structure = TypedPool<CHAP>::create();
 			break;
 
 		case StructureID::SID_COLONIST_LANDER: // only here for loading games
-			structure = new ColonistLander(nullptr);
+			structure = TypedPool<ColonistLander>::create(nullptr);
 			break;
 
 		case StructureID::SID_COMMAND_CENTER:
-			structure = new CommandCenter();
+			structure = TypedPool<CommandCenter>::create();
 			break;
 
 		case StructureID::SID_COMMERCIAL:
-			structure = new Commercial();
+			structure = TypedPool<Commercial>::create();
 			break;
 
 		case StructureID::SID_COMM_TOWER:
-			structure = new CommTower();
+			structure = TypedPool<CommTower>::create();
 			break;
 
 		case StructureID::SID_FUSION_REACTOR:
-			structure = new FusionReactor();
+			structure = TypedPool<FusionReactor>::create();
 			break;
 
 		case StructureID::SID_HOT_LABORATORY:
-			structure = new HotLaboratory();
+			structure = TypedPool<HotLaboratory>::create();
 			break;
 
 		case StructureID::SID_LABORATORY:
-			structure = new Laboratory();
+			structure = TypedPool<Laboratory>::create();
 			break;
 
 		case StructureID::SID_MAINTENANCE_FACILITY:
-			structure = new MaintenanceFacility();
+			structure = TypedPool<MaintenanceFacility>::create();
 			break;
 
 		case StructureID::SID_MEDICAL_CENTER:
-			structure = new MedicalCenter();
+			structure = TypedPool<MedicalCenter>::create();
 			break;
 
 		case StructureID::SID_MINE_FACILITY: // only here for loading games
-			structure = new MineFacility(nullptr);
+			structure = TypedPool<MineFacility>::create(nullptr);
 			break;
 
 		case StructureID::SID_MINE_SHAFT: // only here for loading games
-			structure = new MineShaft();
+			structure = TypedPool<MineShaft>::create();
 			break;
 
 		case StructureID::SID_NURSERY:
-			structure = new Nursery();
+			structure = TypedPool<Nursery>::create();
 			break;
 
 		case StructureID::SID_PARK:
-			structure = new Park();
+			structure = TypedPool<Park>::create();
 			break;
 
 		case StructureID::SID_ROAD:
-			structure = new Road();
+			structure = TypedPool<Road>::create();
 			break;
 
 		case StructureID::SID_SURFACE_POLICE:
-			structure = new SurfacePolice();
+			structure = TypedPool<SurfacePolice>::create();
 			break;
 
 		case StructureID::SID_UNDERGROUND_POLICE:
-			structure = new UndergroundPolice();
+			structure = TypedPool<UndergroundPolice>::create();
 			break;
 
 		case StructureID::SID_RECREATION_CENTER:
-			structure = new RecreationCenter();
+			structure = TypedPool<RecreationCenter>::create();
 			break;
 
 		case StructureID::SID_RECYCLING:
-			structure = new Recycling();
+			structure = TypedPool<Recycling>::create();
 			break;
 
 		case StructureID::SID_RED_LIGHT_DISTRICT:
-			structure = new RedLightDistrict();
+			structure = TypedPool<RedLightDistrict>::create();
 			break;
 
 		case StructureID::SID_RESIDENCE:
-			structure = new Residence();
+			structure = TypedPool<Residence>::create();
 			break;
 
 		case StructureID::SID_ROBOT_COMMAND:
-			structure = new RobotCommand();
+			structure = TypedPool<RobotCommand>::create();
 			break;
 
 		case StructureID::SID_SEED_FACTORY:
-			structure = new SeedFactory();
+			structure = TypedPool<SeedFactory>::create();
 			break;
 
 		case StructureID::SID_SEED_LANDER: // only here for loading games
-			structure = new SeedLander({0, 0});
+			structure = TypedPool<SeedLander>::create(NAS2D::Point{0, 0});
 			break;
 
 		case StructureID::SID_SEED_POWER:
-			structure = new SeedPower();
+			structure = TypedPool<SeedPower>::create();
 			break;
 
 		case StructureID::SID_SEED_SMELTER:
-			structure = new SeedSmelter();
+			structure = TypedPool<SeedSmelter>::create();
 			break;
 
 		case StructureID::SID_SMELTER:
-			structure = new Smelter();
+			structure = TypedPool<Smelter>::create();
 			break;
 
 		case StructureID::SID_SOLAR_PANEL1:
-			structure = new SolarPanelArray(mMeanSolarDistance);
+			structure = TypedPool<SolarPanelArray>::create(mMeanSolarDistance);
 			break;
 
 		case StructureID::SID_SOLAR_PLANT:
-			structure = new SolarPlant(mMeanSolarDistance);
+			structure = TypedPool<SolarPlant>::create(mMeanSolarDistance);
 			break;
 
 		case StructureID::SID_STORAGE_TANKS:
-			structure = new StorageTanks();
+			structure = TypedPool<StorageTanks>::create();
 			break;
 
 		case StructureID::SID_SURFACE_FACTORY:
-			structure = new SurfaceFactory();
+			structure = TypedPool<SurfaceFactory>::create();
 			break;
 
 		case StructureID::SID_UNDERGROUND_FACTORY:
-			structure = new UndergroundFactory();
+			structure = TypedPool<UndergroundFactory>::create();
 			break;
 
 		case StructureID::SID_UNIVERSITY:
-			structure = new University();
+			structure = TypedPool<University>::create();
 			break;
 
 		case StructureID::SID_WAREHOUSE:
-			structure = new Warehouse();
+			structure = TypedPool<Warehouse>::create();
 			break;
 
 
@@ -4,6 +4,7 @@
 #include "ProductPool.h"
 #include "IOHelper.h"
 #include "PopulationPool.h"
+#include "StructureSchema.h"
 #include "Map/Tile.h"
 #include "Things/Robots/Robot.h"
 #include "Things/Structures/Structures.h"
@@ -20,16 +21,6 @@
 
 namespace
 {
-	/**
-	 * Fills population requirements fields in a Structure.
-	 */
-	void fillPopulationRequirements(PopulationPool& populationPool, const PopulationRequirements& required, PopulationRequirements& available)
-	{
-		available[0] = std::min(required[0], populationPool.populationAvailable(PopulationTable::Role::Worker));
-		available[1] = std::min(required[1], populationPool.populationAvailable(PopulationTable::Role::Scientist));
-	}
-
-
 	NAS2D::Xml::XmlElement* serializeStructure(Structure* structure, Tile* tile)
 	{
 		const auto position = tile->position();
@@ -75,59 +66,10 @@ namespace
 			);
 		}
 
-		if (structure->structureClass() == Structure::StructureClass::FoodProduction ||
-			structure->structureId() == StructureID::SID_COMMAND_CENTER)
-		{
-			structureElement->linkEndChild(
-				NAS2D::dictionaryToAttributes(
-					"food",
-					{{{"level", static_cast<FoodProduction*>(structure)->foodLevel()}}}
-				)
-			);
-		}
-
-		if (structure->structureClass() == Structure::StructureClass::Residence)
+		StructureSchema::forEachSection(*structure, [structureElement](const auto& section, const auto& typedStructure)
 		{
-			Residence* residence = static_cast<Residence*>(structure);
-			structureElement->linkEndChild(
-				NAS2D::dictionaryToAttributes(
-					"waste",
-					{{
-						{"accumulated", residence->wasteAccumulated()},
-						{"overflow", residence->wasteOverflow()},
-					}}
-				)
-			);
-		}
-
-		if (structure->isMineFacility())
-		{
-			MineFacility* facility = static_cast<MineFacility*>(structure);
-
-			structureElement->linkEndChild(
-				NAS2D::dictionaryToAttributes(
-					"trucks",
-					{{{"assigned", facility->assignedTrucks()}}}
-				)
-			);
-			structureElement->linkEndChild(
-				NAS2D::dictionaryToAttributes(
-					"extension",
-					{{{"turns_remaining", facility->digTimeRemaining()}}}
-				)
-			);
-		}
-
-		if (structure->structureClass() == Structure::StructureClass::Maintenance)
-		{
-			auto maintenance = static_cast<MaintenanceFacility*>(structure);
-			structureElement->linkEndChild(
-				NAS2D::dictionaryToAttributes(
-					"personnel",
-					{{{"assigned", maintenance->personnel()}}}
-				)
-			);
-		}
+			structureElement->linkEndChild(StructureSchema::write(section, typedStructure));
+		});
 
 		return structureElement;
 	}
@@ -191,6 +133,7 @@ void StructureManager::update(const StorableResources& resources, PopulationPool
 	updateStructures(resources, population, mStructureLists[Structure::StructureClass::Undefined]);
 
 	assignColonistsToResidences(population);
+	markChanged();
 }
 
 
@@ -246,12 +189,24 @@ void StructureManager::assignColonistsToResidences(PopulationPool& population)
 }
 
 
+/**
+ * Updates a list of structures of the same priority.
+ *
+ * Runs in three stages: every structure is updated and checked for the
+ * things that don't depend on other structures, the ones still standing are
+ * staffed and powered together by allocateWorkforce(), then the structures
+ * that got everything they need are enabled and run.
+ */
 void StructureManager::updateStructures(const StorableResources& resources, PopulationPool& population, StructureList& structures)
 {
-	Structure* structure = nullptr;
-	for (std::size_t i = 0; i < structures.size(); ++i)
+	mStaffingRequests.clear();
+
+	// Only CHAP facilities are LifeSupport and they don't need CHAP themselves
+	// so whether one is running can't change while a single list is updated.
+	const bool chapAvailable = CHAPAvailable();
+
+	for (auto structure : structures)
 	{
-		structure = structures[i];
 		structure->update();
 
 		if (structure->ages() && (structure->age() >= structure->maxAge() - 10))
@@ -290,53 +245,99 @@ void StructureManager::updateStructures(const StorableResources& resources, Popu
 		}
 
 		// CHAP Check
-		if (structure->requiresCHAP() && !CHAPAvailable())
+		if (structure->requiresCHAP() && !chapAvailable)
 		{
 			structure->disable(DisabledReason::Chap);
 			continue;
 		}
 
-		// Population Check
+		// Check that enough resources are available for input.
+		const bool resourcesAvailable = structure->isIdle() || resources >= structure->resourcesIn();
+		mStaffingRequests.push_back({structure, resourcesAvailable, DisabledReason::None});
+	}
+
+	allocateWorkforce(population, mStaffingRequests);
+
+	for (const auto& request : mStaffingRequests)
+	{
+		auto structure = request.structure;
+		if (request.outcome != DisabledReason::None)
+		{
+			structure->disable(request.outcome);
+			continue;
+		}
+
+		structure->enable();
+
+		auto consumed = structure->resourcesIn();
+		removeRefinedResources(consumed);
+
+		structure->think();
+	}
+}
+
+
+/**
+ * Assigns workers, scientists and energy to structures in one pass.
+ *
+ * Requests are served in list order and a structure either gets its full
+ * staff and energy or nothing at all, the same as checking structures one at
+ * a time. Checks are made in the order population, energy then resources so
+ * each refused request gets the same DisabledReason as before.
+ *
+ * Every structure's populationAvailable() is filled in with what was free
+ * when its turn came. The population pool and energy used are only updated
+ * once with the totals of all accepted requests.
+ *
+ * \note	Scientists are never borrowed as workers here. A structure only gets
+ *			workers if there are enough unassigned workers to go around.
+ */
+void StructureManager::allocateWorkforce(PopulationPool& population, std::vector<StaffingRequest>& requests)
+{
+	const int workersAvailable = population.populationAvailable(PopulationTable::Role::Worker);
+	const int scientistsAvailable = population.populationAvailable(PopulationTable::Role::Scientist);
+	const int energyAvailable = totalEnergyAvailable();
+
+	int workersAssigned = 0;
+	int scientistsAssigned = 0;
+	int energyAssigned = 0;
+
+	for (auto& request : requests)
+	{
+		auto structure = request.structure;
 		const auto& populationRequired = structure->populationRequirements();
 		auto& populationAvailable = structure->populationAvailable();
 
-		fillPopulationRequirements(population, populationRequired, populationAvailable);
+		populationAvailable[0] = std::min(populationRequired[0], workersAvailable - workersAssigned);
+		populationAvailable[1] = std::min(populationRequired[1], scientistsAvailable - scientistsAssigned);
+
+		const auto energyRequired = structure->energyRequirement();
 
 		if ((populationAvailable[0] < populationRequired[0]) ||
 			(populationAvailable[1] < populationRequired[1]))
 		{
-			structure->disable(DisabledReason::Population);
-			continue;
+			request.outcome = DisabledReason::Population;
 		}
-
-		if (structure->energyRequirement() > totalEnergyAvailable())
+		else if (energyRequired > energyAvailable - energyAssigned)
 		{
-			structure->disable(DisabledReason::Energy);
-			continue;
+			request.outcome = DisabledReason::Energy;
 		}
-
-		// Check that enough resources are available for input.
-		if (!structure->isIdle() && !(resources >= structure->resourcesIn()))
+		else if (!request.resourcesAvailable)
 		{
-			structure->disable(DisabledReason::RefinedResources);
-			continue;
+			request.outcome = DisabledReason::RefinedResources;
 		}
-
-		structure->enable();
-
-		if (structure->operational() || structure->isIdle())
+		else
 		{
-			population.usePopulation(PopulationTable::Role::Worker, populationRequired[0]);
-			population.usePopulation(PopulationTable::Role::Scientist, populationRequired[1]);
-
-			auto consumed = structure->resourcesIn();
-			removeRefinedResources(consumed);
-
-			mTotalEnergyUsed += structure->energyRequirement();
-
-			structure->think();
+			request.outcome = DisabledReason::None;
+			workersAssigned += populationRequired[0];
+			scientistsAssigned += populationRequired[1];
+			energyAssigned += energyRequired;
 		}
 	}
+
+	population.usePopulation(PopulationTable::Role::Worker, workersAssigned);
+	population.usePopulation(PopulationTable::Role::Scientist, scientistsAssigned);
+	mTotalEnergyUsed += energyAssigned;
 }
 
 
@@ -351,7 +352,7 @@ void StructureManager::addStructure(Structure* structure, Tile* tile)
 		return;
 	}
 
-	if (mStructureTileTable.find(structure) != mStructureTileTable.end())
+	if (!mStructureTileTable.try_emplace(structure, tile).second)
 	{
 		throw std::runtime_error("StructureManager::addStructure(): Attempting to add a Structure that is already managed!");
 	}
@@ -362,10 +363,39 @@ void StructureManager::addStructure(Structure* structure, Tile* tile)
 		tile->removeThing();
 	}
 
-	mStructureTileTable[structure] = tile;
-
 	mStructureLists[structure->structureClass()].push_back(structure);
 	tile->pushThing(structure);
+
+	if (structure->isWarehouse()) { mWarehouseIndex.add(static_cast<Warehouse*>(structure)); }
+
+	markChanged();
+}
+
+
+/**
+ * Adds many Structures at once, like when a game is loaded.
+ *
+ * Each class's list is grown once to fit all of its new structures
+ * instead of reallocating as they're added one at a time.
+ */
+void StructureManager::addStructures(const StructureTileList& structures)
+{
+	std::map<Structure::StructureClass, std::size_t> classCounts;
+	for (const auto& [structure, tile] : structures)
+	{
+		++classCounts[structure->structureClass()];
+	}
+
+	for (const auto& [structureClass, count] : classCounts)
+	{
+		auto& list = mStructureLists[structureClass];
+		list.reserve(list.size() + count);
+	}
+
+	for (const auto& [structure, tile] : structures)
+	{
+		addStructure(structure, tile);
+	}
 }
 
 
@@ -386,6 +416,8 @@ void StructureManager::removeStructure(Structure* structure)
 		structures.erase(it);
 	}
 
+	if (structure->isWarehouse()) { mWarehouseIndex.remove(static_cast<Warehouse*>(structure)); }
+
 	const auto tileTableIt = mStructureTileTable.find(structure);
 	const auto isFoundTileTable = tileTableIt != mStructureTileTable.end();
 	if (isFoundTileTable)
@@ -398,6 +430,8 @@ void StructureManager::removeStructure(Structure* structure)
 	{
 		throw std::runtime_error("StructureManager::removeStructure(): Attempting to remove a Structure that is not managed by the StructureManager.");
 	}
+
+	markChanged();
 }
 
 
@@ -494,6 +528,8 @@ int StructureManager::destroyed()
 
 void StructureManager::dropAllStructures()
 {
+	mWarehouseIndex.clear();
+
 	for (auto& pair : mStructureTileTable)
 	{
 		pair.second->deleteThing();
@@ -501,6 +537,7 @@ void StructureManager::dropAllStructures()
 
 	mStructureTileTable.clear();
 	mStructureLists.clear();
+	markChanged();
 }
 
 
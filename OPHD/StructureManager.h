@@ -2,6 +2,11 @@
 
 #include "Things/Structures/Structure.h"
 #include "Things/Structures/Structures.h"
+#include "WarehouseIndex.h"
+
+#include <map>
+#include <utility>
+#include <vector>
 
 
 namespace NAS2D {
@@ -73,7 +78,10 @@ constexpr Structure::StructureClass structureTypeToClass() {
 class StructureManager
 {
 public:
+	using StructureTileList = std::vector<std::pair<Structure*, Tile*>>;
+
 	void addStructure(Structure* structure, Tile* tile);
+	void addStructures(const StructureTileList& structures);
 	void removeStructure(Structure* structure);
 
 	template <typename StructureType>
@@ -124,25 +132,49 @@ public:
 
 	void assignColonistsToResidences(PopulationPool&);
 
+	const WarehouseIndex& warehouseIndex() const { return mWarehouseIndex; }
+
 	void update(const StorableResources&, PopulationPool&);
 
+	/**
+	 * Changes whenever structures are added, removed or updated. Cached
+	 * values derived from structures are stale once this changes.
+	 */
+	unsigned int changeCount() const { return mChangeCount; }
+	void markChanged() { ++mChangeCount; }
+
 	NAS2D::Xml::XmlElement* serialize();
 
 private:
 	using StructureTileTable = std::map<Structure*, Tile*>;
 	using StructureClassTable = std::map<Structure::StructureClass, StructureList>;
 
+	/** A structure waiting to be staffed and powered during an update. */
+	struct StaffingRequest
+	{
+		Structure* structure;
+		bool resourcesAvailable; /**< Enough refined resources for input, or no input needed. */
+		DisabledReason outcome; /**< DisabledReason::None if the structure can run. */
+	};
+
 	void updateStructures(const StorableResources&, PopulationPool&, StructureList&);
+	void allocateWorkforce(PopulationPool&, std::vector<StaffingRequest>&);
 
 	bool structureConnected(Structure* structure);
 
 	StructureTileTable mStructureTileTable; /**< List mapping Structures to a particular tile. */
 	StructureClassTable mStructureLists; /**< Map containing all of the structure list types available. */
 
+	WarehouseIndex mWarehouseIndex;
+
 	StructureList mAgingStructures;
 	StructureList mNewlyBuiltStructures;
 	StructureList mStructuresWithCrime;
 
 	int mTotalEnergyOutput = 0; /**< Total energy output of all energy producers in the structure list. */
 	int mTotalEnergyUsed = 0;
+
+	std::vector<StaffingRequest> mStaffingRequests; /**< Reused by updateStructures() to avoid reallocating every turn. */
+
+	unsigned int mChangeCount = 0;
 };
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Things/Structures/Structures.h"
+
+#include <NAS2D/StringUtils.h>
+#include <NAS2D/Xml/XmlElement.h>
+
+#include <array>
+#include <string>
+#include <stdexcept>
+
+
+/**
+ * Integer field of a structure type, named by its savegame attribute
+ * and accessed through the type's getter/setter pair.
+ */
+template <typename StructureType>
+struct SchemaField
+{
+	const char* name;
+	int (StructureType::*get)() const;
+	void (StructureType::*set)(int);
+};
+
+
+/**
+ * Child element of a saved structure holding a fixed set of fields.
+ */
+template <typename StructureType, std::size_t FieldCount>
+struct SchemaSection
+{
+	const char* element;
+	bool required;
+	std::array<SchemaField<StructureType>, FieldCount> fields;
+};
+
+
+namespace StructureSchema
+{
+	constexpr SchemaSection<FoodProduction, 1> Food{"food", true, {{
+		{"level", &FoodProduction::foodLevel, &FoodProduction::foodLevel},
+	}}};
+
+	constexpr SchemaSection<Residence, 2> Waste{"waste", false, {{
+		{"accumulated", &Residence::wasteAccumulated, &Residence::wasteAccumulated},
+		{"overflow", &Residence::wasteOverflow, &Residence::wasteOverflow},
+	}}};
+
+	constexpr SchemaSection<MineFacility, 1> Trucks{"trucks", false, {{
+		{"assigned", &MineFacility::assignedTrucks, &MineFacility::assignedTrucks},
+	}}};
+
+	constexpr SchemaSection<MineFacility, 1> Extension{"extension", false, {{
+		{"turns_remaining", &MineFacility::digTimeRemaining, &MineFacility::digTimeRemaining},
+	}}};
+
+	constexpr SchemaSection<MaintenanceFacility, 1> Personnel{"personnel", false, {{
+		{"assigned", &MaintenanceFacility::personnel, &MaintenanceFacility::personnel},
+	}}};
+
+
+	/**
+	 * Calls a function with each schema section that applies to a
+	 * structure along with the structure cast to the section's type.
+	 *
+	 * This is the only place that maps structure types to sections so
+	 * saving and loading can't drift apart.
+	 */
+	template <typename Function>
+	void forEachSection(Structure& structure, Function function)
+	{
+		if (structure.structureClass() == Structure::StructureClass::FoodProduction ||
+			structure.structureId() == StructureID::SID_COMMAND_CENTER)
+		{
+			function(Food, static_cast<FoodProduction&>(structure));
+		}
+
+		if (structure.structureClass() == Structure::StructureClass::Residence)
+		{
+			function(Waste, static_cast<Residence&>(structure));
+		}
+
+		if (structure.isMineFacility())
+		{
+			function(Trucks, static_cast<MineFacility&>(structure));
+			function(Extension, static_cast<MineFacility&>(structure));
+		}
+
+		if (structure.structureClass() == Structure::StructureClass::Maintenance)
+		{
+			function(Personnel, static_cast<MaintenanceFacility&>(structure));
+		}
+	}
+
+
+	template <typename StructureType, std::size_t FieldCount>
+	NAS2D::Xml::XmlElement* write(const SchemaSection<StructureType, FieldCount>& section, const StructureType& structure)
+	{
+		auto* element = new NAS2D::Xml::XmlElement(section.element);
+		for (const auto& field : section.fields)
+		{
+			element->attribute(field.name, std::to_string((structure.*field.get)()));
+		}
+		return element;
+	}
+
+
+	/**
+	 * Reads a section from a saved structure element.
+	 *
+	 * Missing fields leave the structure's current value untouched.
+	 *
+	 * \throws	Throws a std::runtime_error if a required section is missing.
+	 */
+	template <typename StructureType, std::size_t FieldCount>
+	void read(const SchemaSection<StructureType, FieldCount>& section, NAS2D::Xml::XmlElement& structureElement, StructureType& structure)
+	{
+		auto* element = structureElement.firstChildElement(section.element);
+		if (!element)
+		{
+			if (section.required)
+			{
+				throw std::runtime_error("StructureSchema::read(): Structure saved without a '" + std::string{section.element} + "' node.");
+			}
+			return;
+		}
+
+		for (const auto& field : section.fields)
+		{
+			const auto& value = element->attribute(field.name);
+			if (!value.empty())
+			{
+				(structure.*field.set)(NAS2D::stringTo<int>(value));
+			}
+		}
+	}
+}
@@ -0,0 +1,147 @@
+#include "TextureAtlas.h"
+
+#include "Cache.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+
+namespace
+{
+	// Keeps the atlas within the texture size any GL implementation
+	// we run on supports. Images that don't fit are drawn on their own.
+	const int MaxAtlasSize = 2048;
+
+	// Gap between packed images so filtering at an image's edge never
+	// samples its neighbour.
+	const int Padding = 1;
+
+
+	struct Placement
+	{
+		std::size_t index;
+		NAS2D::Point<int> position;
+	};
+
+
+	/**
+	 * Shelf packs images tallest first. Images that don't fit are left
+	 * out of the result.
+	 */
+	std::vector<Placement> pack(const std::vector<NAS2D::Vector<int>>& sizes, NAS2D::Vector<int>& atlasSize)
+	{
+		std::vector<std::size_t> order(sizes.size());
+		std::iota(order.begin(), order.end(), std::size_t{0});
+		std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) { return sizes[a].y > sizes[b].y; });
+
+		std::vector<Placement> placements;
+		NAS2D::Point<int> cursor{0, 0};
+		int shelfHeight = 0;
+		atlasSize = {0, 0};
+
+		for (auto index : order)
+		{
+			const auto size = sizes[index];
+			if (size.x > MaxAtlasSize) { continue; }
+
+			if (cursor.x + size.x > MaxAtlasSize)
+			{
+				cursor = {0, cursor.y + shelfHeight + Padding};
+				shelfHeight = 0;
+			}
+
+			if (cursor.y + size.y > MaxAtlasSize) { continue; }
+
+			placements.push_back({index, cursor});
+			atlasSize.x = std::max(atlasSize.x, cursor.x + size.x);
+			atlasSize.y = std::max(atlasSize.y, cursor.y + size.y);
+			shelfHeight = std::max(shelfHeight, size.y);
+			cursor.x += size.x + Padding;
+		}
+
+		return placements;
+	}
+}
+
+
+void drawSubImage(NAS2D::Renderer& renderer, const AtlasImage& image, NAS2D::Point<float> position, const NAS2D::Rectangle<float>& subImageRect, NAS2D::Color color)
+{
+	renderer.drawSubImage(*image.image, position, image.subImageRect(subImageRect), color);
+}
+
+
+/**
+ * Packs the given images into a new atlas texture.
+ *
+ * Entries already handed out by image() are updated in place so any
+ * references to them stay valid.
+ *
+ * Source images are read from decodedImageCache so only the atlas
+ * itself is made into a texture. Preload them to decode them on workers.
+ *
+ * \warning	Only call once. Entries packed by an earlier call would be
+ *			left pointing at a destroyed texture.
+ *
+ * \note	Must be called from the thread that owns the renderer since
+ *			it creates a texture.
+ */
+void TextureAtlas::build(const std::vector<std::string>& filenames)
+{
+	std::vector<NAS2D::Vector<int>> sizes;
+	for (const auto& filename : filenames)
+	{
+		sizes.push_back(decodedImageCache.get(filename).size());
+	}
+
+	NAS2D::Vector<int> atlasSize;
+	const auto placements = pack(sizes, atlasSize);
+	if (placements.empty()) { return; }
+
+	std::vector<std::uint8_t> pixels(static_cast<std::size_t>(atlasSize.x * atlasSize.y) * 4, 0);
+	for (const auto& [index, position] : placements)
+	{
+		const auto& source = decodedImageCache.get(filenames[index]);
+		for (int y = 0; y < sizes[index].y; ++y)
+		{
+			for (int x = 0; x < sizes[index].x; ++x)
+			{
+				const auto color = source.pixelColor({x, y});
+				const auto offset = static_cast<std::size_t>((position.y + y) * atlasSize.x + position.x + x) * 4;
+				pixels[offset] = color.red;
+				pixels[offset + 1] = color.green;
+				pixels[offset + 2] = color.blue;
+				pixels[offset + 3] = color.alpha;
+			}
+		}
+	}
+
+	mTexture = std::make_unique<NAS2D::Image>(pixels.data(), 4, atlasSize);
+
+	for (const auto& [index, position] : placements)
+	{
+		mImages[filenames[index]] = AtlasImage{mTexture.get(), position - NAS2D::Point{0, 0}, sizes[index]};
+	}
+}
+
+
+void TextureAtlas::clear()
+{
+	mImages.clear();
+	mTexture.reset();
+}
+
+
+/**
+ * Gets where an image can be drawn from.
+ *
+ * Images that weren't packed by build() are loaded on their own.
+ */
+const AtlasImage& TextureAtlas::image(const std::string& filename)
+{
+	const auto it = mImages.find(filename);
+	if (it != mImages.end()) { return it->second; }
+
+	const auto& image = imageCache.load(filename);
+	return mImages[filename] = AtlasImage{&image, {0, 0}, image.size()};
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <NAS2D/Renderer/Renderer.h>
+#include <NAS2D/Renderer/Color.h>
+#include <NAS2D/Renderer/Point.h>
+#include <NAS2D/Renderer/Rectangle.h>
+#include <NAS2D/Renderer/Vector.h>
+#include <NAS2D/Resource/Image.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/**
+ * Where a source image ended up in a texture atlas.
+ *
+ * Images that weren't packed point at the image itself with no offset
+ * so callers don't need to care whether packing happened.
+ */
+struct AtlasImage
+{
+	const NAS2D::Image* image = nullptr; /**< Texture to draw from. */
+	NAS2D::Vector<int> offset; /**< Position of the source image within \c image. */
+	NAS2D::Vector<int> size; /**< Size of the source image. */
+
+	NAS2D::Rectangle<float> subImageRect(const NAS2D::Rectangle<float>& rect) const
+	{
+		return {rect.x + static_cast<float>(offset.x), rect.y + static_cast<float>(offset.y), rect.width, rect.height};
+	}
+};
+
+
+void drawSubImage(NAS2D::Renderer& renderer, const AtlasImage& image, NAS2D::Point<float> position, const NAS2D::Rectangle<float>& subImageRect, NAS2D::Color color = NAS2D::Color::Normal);
+
+
+/**
+ * Packs several images into a single texture so drawing from any of
+ * them doesn't need a texture switch.
+ *
+ * Packing is done once at startup with build(). Drawing code looks its
+ * sheets up with image() and draws them with drawSubImage().
+ *
+ * \warning	References returned by image() are invalidated by clear().
+ */
+class TextureAtlas
+{
+public:
+	void build(const std::vector<std::string>& filenames);
+
+	const AtlasImage& image(const std::string& filename);
+
+	const NAS2D::Image* texture() const { return mTexture.get(); }
+
+	void clear();
+
+private:
+	std::unique_ptr<NAS2D::Image> mTexture;
+	std::map<std::string, AtlasImage> mImages;
+};
@@ -4,6 +4,11 @@
 
 #include <NAS2D/Dictionary.h>
 
+#include <cstdint>
+
+
+class RobotCommand;
+
 
 class Robot: public Thing
 {
@@ -19,6 +24,14 @@ public:
 
 	using TaskSignal = NAS2D::Signal<Robot*>;
 
+	/** Where a RobotPool keeps this robot. Maintained by the pool. */
+	struct PoolIndex
+	{
+		std::size_t slot = 0;
+		std::uint32_t generation = 0;
+		std::size_t idle = 0; /**< Position in the pool's idle list. */
+	};
+
 public:
 	Robot(const std::string&, const std::string&, Type);
 	Robot(const std::string&, const std::string&, const std::string&, Type);
@@ -44,6 +57,12 @@ public:
 	void id(int newId) { mId = newId; }
 	int id() const { return mId; }
 
+	RobotCommand* robotCommand() const { return mRobotCommand; }
+	void robotCommand(RobotCommand* commandFacility) { mRobotCommand = commandFacility; }
+
+	PoolIndex& poolIndex() { return mPoolIndex; }
+	const PoolIndex& poolIndex() const { return mPoolIndex; }
+
 	virtual NAS2D::Dictionary getDataDict() const;
 
 protected:
@@ -60,5 +79,8 @@ private:
 
 	Type mType{ Type::None };
 
+	RobotCommand* mRobotCommand = nullptr; /**< Robot Command Facility the robot is under the command of, if any. */
+	PoolIndex mPoolIndex;
+
 	TaskSignal mTaskCompleteSignal;
 };
@@ -22,7 +22,7 @@ public:
 
 	void ug()
 	{
-		sprite().play(constants::StructureStateOperationalUg);
+		play(constants::StructureStateOperationalUg);
 		mIsUnderground = true;
 	}
 
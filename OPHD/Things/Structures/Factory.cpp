@@ -92,58 +92,87 @@ ProductType Factory::pullProduct()
 
 
 /**
- * Production update loop.
+ * Runs a turn of production for every factory.
+ *
+ * Factories that can work this turn are gathered first along with what their
+ * product costs. Resources are then reserved for them in list order, so when
+ * there isn't enough to go around the factories earlier in the list always
+ * win. Everything reserved is pulled from storage at once before production
+ * counters are advanced.
+ *
+ * \param	resourcesAvailable	Refined resources in storage at the start of the pass.
+ * \param	productsWaiting		Filled with the factories that still had a finished
+ *								product waiting from an earlier turn. These don't
+ *								produce and should be idled once the caller has
+ *								tried to move their product out.
+ * \param	productsCompleted	Filled with the factories that finished a product
+ *								this turn.
+ *
+ * \throws	std::runtime_error if storage holds less than resourcesAvailable.
  */
-void Factory::updateProduction()
+void Factory::updateProduction(const FactoryList& factories, const StorableResources& resourcesAvailable, FactoryList& productsWaiting, FactoryList& productsCompleted)
 {
-	/**
-	 * A few check conditions to see if we're doing any processing.
-	 * 
-	 * \fixme	Most of these can be combined into a single
-	 *			compound conditional statement.
-	 */
-	if (state() != StructureState::Operational)
-	{
-		return;
-	}
+	productsWaiting.clear();
+	productsCompleted.clear();
 
-	if (mProduct == ProductType::PRODUCT_NONE)
-	{
-		return;
-	}
+	FactoryList producing;
+	std::vector<StorableResources> costs;
 
-	if (mProductWaiting != ProductType::PRODUCT_NONE)
+	for (auto factory : factories)
 	{
-		mProductionComplete(*this);
-		idle(IdleReason::FactoryProductionComplete);
-		return;
+		if (factory->state() != StructureState::Operational) { continue; }
+		if (factory->mProduct == ProductType::PRODUCT_NONE) { continue; }
+
+		if (factory->mProductWaiting != ProductType::PRODUCT_NONE)
+		{
+			productsWaiting.push_back(factory);
+			continue;
+		}
+
+		const auto& productionCost = PRODUCTION_TYPE_TABLE.at(factory->mProduct);
+		producing.push_back(factory);
+		costs.push_back({
+			productionCost.commonMetals(),
+			productionCost.commonMinerals(),
+			productionCost.rareMetals(),
+			productionCost.rareMinerals()
+		});
 	}
 
-	if (!enoughResourcesAvailable())
+	auto remaining = resourcesAvailable;
+	StorableResources reserved;
+	std::vector<bool> hasResources(producing.size(), false);
+
+	for (std::size_t i = 0; i < producing.size(); ++i)
 	{
-		idle(IdleReason::FactoryInsufficientResources);
-		return;
+		if (!(remaining >= costs[i]))
+		{
+			producing[i]->idle(IdleReason::FactoryInsufficientResources);
+			continue;
+		}
+
+		remaining -= costs[i];
+		reserved += costs[i];
+		hasResources[i] = true;
 	}
 
-	const auto& productionCost = PRODUCTION_TYPE_TABLE.at(mProduct);
-	StorableResources cost {
-		productionCost.commonMetals(),
-		productionCost.commonMinerals(),
-		productionCost.rareMetals(),
-		productionCost.rareMinerals()
-	};
+	removeRefinedResources(reserved);
 
-	removeRefinedResources(cost);
+	if (!reserved.isEmpty()) { throw std::runtime_error("Factory::updateProduction(): Production cost not empty"); }
 
-	if (!cost.isEmpty()) { throw std::runtime_error("Factory::updateProduction(): Production cost not empty"); }
+	for (std::size_t i = 0; i < producing.size(); ++i)
+	{
+		if (!hasResources[i]) { continue; }
 
-	++mTurnsCompleted;
+		auto& factory = *producing[i];
+		++factory.mTurnsCompleted;
 
-	if (mTurnsCompleted > mTurnsToComplete)
-	{
-		productionResetTurns();
-		mProductWaiting = mProduct;
-		mProductionComplete(*this);
+		if (factory.mTurnsCompleted > factory.mTurnsToComplete)
+		{
+			factory.productionResetTurns();
+			factory.mProductWaiting = factory.mProduct;
+			productsCompleted.push_back(&factory);
+		}
 	}
 }
 
@@ -157,26 +186,6 @@ NAS2D::Dictionary Factory::getDataDict() const
 }
 
 
-bool Factory::enoughResourcesAvailable()
-{
-	if (mResources == nullptr) { throw std::runtime_error("Factory::enoughResourcesAvailable() called with a null Resource Pool set"); }
-
-	/**
-	 * \todo	Have this use operator>= once the production table is converted to using StorableResources
-	 */
-	const auto& productionCost = PRODUCTION_TYPE_TABLE.at(mProduct);
-	if (mResources->resources[0] >= productionCost.commonMetals() &&
-		mResources->resources[1] >= productionCost.commonMinerals() &&
-		mResources->resources[2] >= productionCost.rareMetals() &&
-		mResources->resources[3] >= productionCost.rareMinerals())
-	{
-		return true;
-	}
-
-	return false;
-}
-
-
 void Factory::addProduct(ProductType type)
 {
 	if (find(mAvailableProducts.begin(), mAvailableProducts.end(), type) != mAvailableProducts.end())
@@ -15,27 +15,20 @@ class ProductionCost;
  * the underlying factory production code. Exactly what a factory is capable of
  * producing is up to the derived factory type.
  *
- * \note	The Factory interface defines two public functions: resourcePool() and robotoPool().
- *			These must be called manually whenever a derived factory type is added to the game as
- *			there are no manager objects that do this (by design).
- *
- * \warning	There are no sanity checks in the underlying production code to check if resourcePool
- *			or robotPool have been properly set. It is assumed that they have been.
+ * Production for all factories is run together once per turn by the static
+ * updateProduction() function. Finished products are handed back to the caller
+ * to be moved out of the factories.
  */
 class Factory : public Structure
 {
 public:
-	// Signal providing what was complete and a reference to the Factory.
-	using ProductionSignal = NAS2D::Signal<Factory&>;
-
 	using ProductionTypeList = std::vector<ProductType>;
+	using FactoryList = std::vector<Factory*>;
 
 public:
 	Factory(const std::string& name, const std::string& spritePath, StructureID id);
 
-	virtual void updateProduction();
-
-	void resourcePool(const StorableResources* resources) { mResources = resources; }
+	static void updateProduction(const FactoryList& factories, const StorableResources& resourcesAvailable, FactoryList& productsWaiting, FactoryList& productsCompleted);
 
 	int productionTurnsToComplete() const { return mTurnsToComplete; }
 	void productionTurnsToComplete(int newTurnsToComplete) { mTurnsToComplete = newTurnsToComplete; }
@@ -54,17 +47,12 @@ public:
 
 	virtual void initFactory() = 0;
 
-	ProductionSignal::Source& productionComplete() { return mProductionComplete; }
-
 	NAS2D::Dictionary getDataDict() const override;
 
 protected:
 	void clearProduction();
 
 	void addProduct(ProductType type);
-	bool enoughResourcesAvailable();
-
-	const StorableResources* resourcePool() { return mResources; }
 
 private:
 	int mTurnsCompleted = 0;
@@ -74,10 +62,6 @@ private:
 	ProductType mProductWaiting = ProductType::PRODUCT_NONE; /**< Product that is waiting to be pulled from the factory. */
 
 	ProductionTypeList mAvailableProducts; /**< List of products that the Factory can produce. */
-
-	ProductionSignal mProductionComplete; /**< Signal used when production is complete. */
-
-	const StorableResources* mResources = nullptr; /**< Pointer to the player's resource pool. UGLY. */
 };
 
 const ProductionCost& productCost(ProductType);
@@ -26,7 +26,7 @@ MineFacility::MineFacility(Mine* mine) : Structure(constants::MineFacility,
 	StructureID::SID_MINE_FACILITY),
 	mMine(mine)
 {
-	sprite().play(constants::StructureStateConstruction);
+	play(constants::StructureStateConstruction);
 	maxAge(1200);
 	turnsToBuild(2);
 	integrityDecayRate(0);
@@ -34,6 +34,22 @@ MineFacility::MineFacility(Mine* mine) : Structure(constants::MineFacility,
 	requiresCHAP(false);
 	selfSustained(true);
 	storageCapacity(500);
+
+	if (mMine) { mMine->oreExhausted().connect(this, &MineFacility::onMineExhausted); }
+}
+
+
+MineFacility::~MineFacility()
+{
+	if (mMine) { mMine->oreExhausted().disconnect(this, &MineFacility::onMineExhausted); }
+}
+
+
+void MineFacility::mine(Mine* mine)
+{
+	if (mMine) { mMine->oreExhausted().disconnect(this, &MineFacility::onMineExhausted); }
+	mMine = mine;
+	if (mMine) { mMine->oreExhausted().connect(this, &MineFacility::onMineExhausted); }
 }
 
 
@@ -89,26 +105,18 @@ void MineFacility::think()
 			return;
 		}
 
-		StorableResources ore;
+		Mine::MineVein quantities{0, 0, 0, 0};
+		if (mMine->miningCommonMetals()) { quantities[Mine::OreType::ORE_COMMON_METALS] = pullCount(this, 0); }
+		if (mMine->miningCommonMinerals()) { quantities[Mine::OreType::ORE_COMMON_MINERALS] = pullCount(this, 1); }
+		if (mMine->miningRareMetals()) { quantities[Mine::OreType::ORE_RARE_METALS] = pullCount(this, 2); }
+		if (mMine->miningRareMinerals()) { quantities[Mine::OreType::ORE_RARE_MINERALS] = pullCount(this, 3); }
 
-		if (mMine->miningCommonMetals())
-		{
-			ore.resources[0] = mMine->pull(Mine::OreType::ORE_COMMON_METALS, pullCount(this, 0));
-		}
+		const auto pulled = mMine->pull(quantities);
 
-		if (mMine->miningCommonMinerals())
-		{
-			ore.resources[1] = mMine->pull(Mine::OreType::ORE_COMMON_MINERALS, pullCount(this, 1));
-		}
-
-		if (mMine->miningRareMetals())
-		{
-			ore.resources[2] = mMine->pull(Mine::OreType::ORE_RARE_METALS, pullCount(this, 2));
-		}
-
-		if (mMine->miningRareMinerals())
+		StorableResources ore;
+		for (std::size_t i = 0; i < pulled.size(); ++i)
 		{
-			ore.resources[3] = mMine->pull(Mine::OreType::ORE_RARE_MINERALS, pullCount(this, 3));
+			ore.resources[i] = pulled[i];
 		}
 
 		storage() += ore;
@@ -120,6 +128,16 @@ void MineFacility::think()
 }
 
 
+/**
+ * Idles the facility as soon as the last of the ore is pulled instead of
+ * waiting for the next turn to notice.
+ */
+void MineFacility::onMineExhausted(Mine*)
+{
+	idle(IdleReason::MineExhausted);
+}
+
+
 bool MineFacility::canExtend() const
 {
 	return (mMine->depth() < mMaxDepth) && (mDigTurnsRemaining == 0);
@@ -13,8 +13,9 @@ public:
 	using ExtensionCompleteSignal = NAS2D::Signal<MineFacility*>;
 public:
 	MineFacility(Mine* mine);
+	~MineFacility() override;
 
-	void mine(Mine* mine) { mMine = mine; }
+	void mine(Mine* mine);
 	void maxDepth(int depth) { mMaxDepth = depth; }
 
 	bool extending() const;
@@ -36,9 +37,7 @@ public:
 
 	ExtensionCompleteSignal::Source& extensionComplete() { return mExtensionComplete; }
 
-protected:
-	friend class MapViewState;
-
+	// Only meant for restoring a saved game. StructureSchema takes their addresses.
 	void assignedTrucks(int count) { mAssignedTrucks = count; }
 	void digTimeRemaining(int count) { mDigTurnsRemaining = count; }
 
@@ -53,6 +52,8 @@ private:
 private:
 	void activated() override;
 
+	void onMineExhausted(Mine* mine);
+
 private:
 	int mMaxDepth = 0; /**< Maximum digging depth. */
 	int mDigTurnsRemaining = 0; /**< Turns remaining before extension is complete. */
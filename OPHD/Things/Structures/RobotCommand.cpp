@@ -8,6 +8,19 @@
 #include <algorithm>
 
 
+/**
+ * Clears the back-reference of every robot still under the facility's
+ * command so none of them are left pointing at it.
+ */
+RobotCommand::~RobotCommand()
+{
+	for (auto robot : mRobotList)
+	{
+		robot->robotCommand(nullptr);
+	}
+}
+
+
 /**
  * Gets whether the command facility has additional command capacity remaining.
  */
@@ -22,7 +35,7 @@ bool RobotCommand::commandCapacityAvailable() const
  */
 bool RobotCommand::isControlling(Robot* robot) const
 {
-	return find(mRobotList.begin(), mRobotList.end(), robot) != mRobotList.end();
+	return robot->robotCommand() == this;
 }
 
 
@@ -42,6 +55,7 @@ void RobotCommand::addRobot(Robot* robot)
 	}
 
 	mRobotList.push_back(robot);
+	robot->robotCommand(this);
 }
 
 
@@ -50,5 +64,8 @@ void RobotCommand::addRobot(Robot* robot)
  */
 void RobotCommand::removeRobot(Robot* robot)
 {
+	if (!isControlling(robot)) { return; }
+
 	mRobotList.erase(std::remove(mRobotList.begin(), mRobotList.end(), robot), mRobotList.end());
+	robot->robotCommand(nullptr);
 }
@@ -28,6 +28,8 @@ public:
 		hasCrime(true);
 	}
 
+	~RobotCommand() override;
+
 	bool isControlling(Robot* robot) const;
 
 	bool commandCapacityAvailable() const;
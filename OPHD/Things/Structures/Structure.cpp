@@ -129,7 +129,7 @@ Structure::Structure(const std::string& name, const std::string& spritePath, con
  */
 void Structure::disable(DisabledReason reason)
 {
-	sprite().pause();
+	pause();
 	sprite().color(NAS2D::Color{255, 0, 0, 185});
 	state(StructureState::Disabled);
 	mDisabledReason = reason;
@@ -149,7 +149,7 @@ void Structure::enable()
 		return;
 	}
 
-	sprite().resume();
+	resume();
 	sprite().color(NAS2D::Color::White);
 	state(StructureState::Operational);
 	mDisabledReason = DisabledReason::None;
@@ -167,7 +167,7 @@ void Structure::idle(IdleReason reason)
 		return;
 	}
 
-	sprite().pause();
+	pause();
 	sprite().color(NAS2D::Color{255, 255, 255, 185});
 	mDisabledReason = DisabledReason::None;
 	mIdleReason = reason;
@@ -226,7 +226,7 @@ const std::string& Structure::classDescription(Structure::StructureClass structu
  */
 void Structure::activate()
 {
-	sprite().play(constants::StructureStateOperational);
+	play(constants::StructureStateOperational);
 	enable();
 
 	defineResourceInput();
@@ -295,7 +295,7 @@ void Structure::updateIntegrityDecay()
 */
 void Structure::destroy()
 {
-	sprite().play(constants::StructureStateDestroyed);
+	play(constants::StructureStateDestroyed);
 	state(StructureState::Destroyed);
 
 	// Destroyed buildings just need to be rebuilt right?
@@ -312,7 +312,7 @@ void Structure::forced_state_change(StructureState structureState, DisabledReaso
 
 	if (age() >= turnsToBuild())
 	{
-		sprite().play(constants::StructureStateOperational);
+		play(constants::StructureStateOperational);
 		//enable();
 	}
 
@@ -3,6 +3,7 @@
 #include "../Thing.h"
 
 #include "../../Common.h"
+#include "../../ObjectPool.h"
 #include "../../StorableResources.h"
 #include "../../UI/StringTable.h"
 
@@ -71,6 +72,11 @@ public:
 
 	~Structure() override = default;
 
+	// Structures are built and bulldozed all game long so each type is kept in its own pool.
+	// Build them with TypedPool<T>::create(). A plain delete returns them to their pool.
+	static void* operator new(std::size_t) = delete;
+	static void operator delete(void* pointer) { if (pointer) { ObjectPool::owner(pointer).deallocate(pointer); } }
+
 	// STATES & STATE MANAGEMENT
 	StructureState state() const { return mStructureState; }
 
@@ -22,6 +22,7 @@ public:
 	}
 
 	ProductPool& products() { return mProducts; }
+	const ProductPool& products() const { return mProducts; }
 
 protected:
 	void defineResourceInput() override
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../Cache.h"
+
 #include <NAS2D/Signal/Signal.h>
 #include <NAS2D/Resource/Sprite.h>
 
@@ -18,7 +20,9 @@ public:
 public:
 	Thing(const std::string& name, const std::string& spritePath, const std::string& initialAction) :
 		mName(name),
-		mSprite(spritePath, initialAction)
+		mSpritePath(spritePath),
+		mSprite(spriteCache.sprite(spritePath, initialAction)),
+		mAnimated(spriteCache.animated(spritePath, initialAction))
 	{}
 
 	virtual ~Thing()
@@ -43,6 +47,17 @@ public:
 	 */
 	NAS2D::Sprite& sprite() { return mSprite; }
 
+	/**
+	 * Plays, pauses and resumes the Thing's sprite. Use these instead of
+	 * the sprite's own functions so the Thing knows whether drawing it
+	 * needs a new frame now and then.
+	 */
+	void play(const std::string& action) { mSprite.play(action); mAnimated = spriteCache.animated(mSpritePath, action); mPaused = false; }
+	void pause() { mSprite.pause(); mPaused = true; }
+	void resume() { mSprite.resume(); mPaused = false; }
+
+	bool animating() const { return mAnimated && !mPaused; }
+
 	virtual void die() { mIsDead = true; mDieSignal(this); }
 	bool dead() const { return mIsDead; }
 
@@ -56,7 +71,10 @@ private:
 
 private:
 	std::string mName; /**< Name of the Thing. */
+	std::string mSpritePath; /**< Sprite file mSprite was loaded from. */
 	NAS2D::Sprite mSprite; /**< Sprite used to represent the Thing. */
+	bool mAnimated = false; /**< The action being played has more than one frame. */
+	bool mPaused = false;
 
 	bool mIsDead = false;/**< Thing is dead and should be cleaned up. */
 
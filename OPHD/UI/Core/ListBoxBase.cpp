@@ -44,20 +44,20 @@ ListBoxBase::~ListBoxBase()
 
 
 /**
- * True if no items are in the list.
+ * True if no items are shown in the list.
  */
 bool ListBoxBase::isEmpty() const
 {
-	return mItems.empty();
+	return mRows.empty();
 }
 
 
 /**
- * Number of items in the ListBoxBase.
+ * Number of items shown in the ListBoxBase.
  */
 std::size_t ListBoxBase::count() const
 {
-	return mItems.size();
+	return mRows.size();
 }
 
 
@@ -74,11 +74,11 @@ void ListBoxBase::updateScrollLayout()
 {
 	mItemWidth = mRect.width;
 
-	if ((mItemHeight * static_cast<int>(mItems.size())) > mRect.height)
+	if ((mItemHeight * static_cast<int>(mRows.size())) > mRect.height)
 	{
 		mSlider.position({rect().x + mRect.width - 14, mRect.y});
 		mSlider.size({14, mRect.height});
-		mSlider.length(static_cast<float>(mItemHeight * static_cast<int>(mItems.size()) - mRect.height));
+		mSlider.length(static_cast<float>(mItemHeight * static_cast<int>(mRows.size()) - mRect.height));
 		mScrollOffsetInPixels = static_cast<unsigned int>(mSlider.thumbPosition());
 		mItemWidth -= static_cast<unsigned int>(mSlider.size().x);
 		mSlider.visible(true);
@@ -121,7 +121,7 @@ void ListBoxBase::onMouseDown(EventHandler::MouseButton button, int x, int y)
 	// A few basic checks
 	if (!rect().contains(point) || mHighlightIndex == constants::NoSelection) { return; }
 	if (mSlider.visible() && mSlider.rect().contains(point)) { return; }
-	if (mHighlightIndex >= mItems.size()) { return; }
+	if (mHighlightIndex >= mRows.size()) { return; }
 
 	setSelection(mHighlightIndex);
 }
@@ -153,7 +153,7 @@ void ListBoxBase::onMouseMove(int x, int y, int /*relX*/, int /*relY*/)
 
 	mHighlightIndex = (static_cast<unsigned int>(y - positionY()) + mScrollOffsetInPixels) / static_cast<unsigned int>(mItemHeight);
 
-	if (mHighlightIndex >= mItems.size())
+	if (mHighlightIndex >= mRows.size())
 	{
 		mHighlightIndex = constants::NoSelection;
 	}
@@ -197,6 +197,7 @@ void ListBoxBase::clear()
 {
 	for (auto item : mItems) { delete item; }
 	mItems.clear();
+	mRows.clear();
 	mSelectedIndex = constants::NoSelection;
 	mHighlightIndex = constants::NoSelection;
 	updateScrollLayout();
@@ -234,7 +235,7 @@ const ListBoxBase::ListBoxItem& ListBoxBase::selected() const
 		throw std::runtime_error("ListBox has no selected item");
 	}
 
-	return *mItems[mSelectedIndex];
+	return *mRows[mSelectedIndex];
 }
 
 
@@ -245,7 +246,7 @@ const ListBoxBase::ListBoxItem& ListBoxBase::selected() const
  */
 void ListBoxBase::setSelection(std::size_t selection)
 {
-	mSelectedIndex = (selection < mItems.size()) ? selection : constants::NoSelection;
+	mSelectedIndex = (selection < mRows.size()) ? selection : constants::NoSelection;
 	mSelectionChanged();
 }
 
@@ -259,6 +260,88 @@ void ListBoxBase::clearSelected()
 }
 
 
+/**
+ * Range [first, end) of the items that are at least partly within the
+ * control at the current scroll position.
+ *
+ * \note	Derived types should only draw these so large lists cost the
+ *			same to draw as short ones.
+ */
+std::pair<std::size_t, std::size_t> ListBoxBase::visibleItemRange() const
+{
+	const auto itemHeight = static_cast<unsigned int>(mItemHeight);
+	const std::size_t first = mScrollOffsetInPixels / itemHeight;
+	const std::size_t end = (mScrollOffsetInPixels + static_cast<unsigned int>(mRect.height) + itemHeight - 1) / itemHeight;
+
+	return {std::min(first, mRows.size()), std::min(end, mRows.size())};
+}
+
+
+/**
+ * Removes and destroys an item.
+ *
+ * The selection stays on the same item unless it's the one removed.
+ */
+void ListBoxBase::remove(const ListBoxItem& item)
+{
+	const auto row = rowIndex(item);
+	if (row != constants::NoSelection)
+	{
+		mRows.erase(mRows.begin() + static_cast<std::ptrdiff_t>(row));
+		if (mSelectedIndex == row) { mSelectedIndex = constants::NoSelection; }
+		else if (mSelectedIndex != constants::NoSelection && mSelectedIndex > row) { --mSelectedIndex; }
+		mHighlightIndex = constants::NoSelection;
+	}
+
+	const auto it = std::find(mItems.begin(), mItems.end(), &item);
+	if (it != mItems.end())
+	{
+		delete *it;
+		mItems.erase(it);
+	}
+
+	updateScrollLayout();
+}
+
+
+/**
+ * Sets which items are shown as rows and rebuilds the rows from the
+ * items. Items aren't created or destroyed.
+ *
+ * \param	itemFilter	Returns true for items to show. Pass an empty
+ *						filter to show every item.
+ *
+ * \note	The selection stays on the same item if it's still shown.
+ */
+void ListBoxBase::filter(ItemFilter itemFilter)
+{
+	const auto* selectedItem = isItemSelected() ? mRows[mSelectedIndex] : nullptr;
+
+	mFilter = std::move(itemFilter);
+	mRows.clear();
+	for (auto item : mItems)
+	{
+		if (!mFilter || mFilter(*item)) { mRows.push_back(item); }
+	}
+
+	mSelectedIndex = selectedItem ? rowIndex(*selectedItem) : constants::NoSelection;
+	mHighlightIndex = constants::NoSelection;
+	updateScrollLayout();
+}
+
+
+/**
+ * Row an item is shown in.
+ *
+ * \return	Returns constants::NoSelection if the item isn't shown.
+ */
+std::size_t ListBoxBase::rowIndex(const ListBoxItem& item) const
+{
+	const auto it = std::find(mRows.begin(), mRows.end(), &item);
+	return it != mRows.end() ? static_cast<std::size_t>(it - mRows.begin()) : constants::NoSelection;
+}
+
+
 /**
  * Sets item height.
  * 
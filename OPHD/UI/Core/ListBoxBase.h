@@ -10,7 +10,9 @@
 
 #include <string>
 #include <vector>
+#include <utility>
 #include <cstddef>
+#include <functional>
 
 
 /**
@@ -18,6 +20,11 @@
  * input handling and management code while leaving the specific implementation
  * to more derived types.
  * 
+ * Items can be hidden with a filter. Only items passing the filter are
+ * shown as rows, in the order the items were added. The rows are kept
+ * up to date as items are added and removed so changing what's listed
+ * doesn't need the list rebuilt.
+ *
  * \note	This is an abstract class -- it will need to be inherited from
  *			in order to be used.
  */
@@ -49,7 +56,7 @@ public:
 	bool isEmpty() const;
 	std::size_t count() const;
 
-	void clear();
+	virtual void clear();
 
 	bool isItemSelected() const;
 	const ListBoxItem& selected() const;
@@ -64,12 +71,22 @@ public:
 	void update() override = 0;
 
 protected:
+	using ItemFilter = std::function<bool(const ListBoxItem&)>;
+
 	template <typename ItemType, typename... Args>
-	void add(Args&&... args) {
-		mItems.emplace_back(new ItemType{std::forward<Args>(args)...});
+	ItemType& add(Args&&... args) {
+		auto* item = new ItemType{std::forward<Args>(args)...};
+		mItems.push_back(item);
+		if (!mFilter || mFilter(*item)) { mRows.push_back(item); }
 		updateScrollLayout();
+		return *item;
 	}
 
+	void remove(const ListBoxItem& item);
+	void filter(ItemFilter itemFilter);
+
+	std::size_t rowIndex(const ListBoxItem& item) const;
+
 	void updateScrollLayout();
 
 	unsigned int item_width() const { return static_cast<unsigned int>(mItemWidth); }
@@ -78,10 +95,13 @@ protected:
 
 	unsigned int draw_offset() const { return mScrollOffsetInPixels; }
 
+	std::pair<std::size_t, std::size_t> visibleItemRange() const;
+
 	void onVisibilityChange(bool) override;
 
 
-	std::vector<ListBoxItem*> mItems; /**< List of Items. Pointers used for polymorphism. */
+	std::vector<ListBoxItem*> mItems; /**< All items in the order they were added. Pointers used for polymorphism. */
+	std::vector<ListBoxItem*> mRows; /**< Items passing the filter in the same order as mItems. Row indices index into this. */
 
 private:
 	void onSlideChange(float newPosition);
@@ -106,6 +126,8 @@ private:
 	NAS2D::Color mHighlightBg = NAS2D::Color::DarkGreen; /**< Highlight Background color. */
 	NAS2D::Color mHighlightText = NAS2D::Color::White; /**< Text Color for an item that is currently highlighted. */
 
+	ItemFilter mFilter; /**< Items shown as rows. Every item is shown if empty. */
+
 	SelectionChangeSignal mSelectionChanged; /**< Signal for selection changed callback. */
 	Slider mSlider; /**< Slider control. */
 };
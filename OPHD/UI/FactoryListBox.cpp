@@ -8,20 +8,34 @@
 #include <NAS2D/Utility.h>
 #include <NAS2D/Renderer/Renderer.h>
 
+#include <unordered_set>
+
 
 using namespace NAS2D;
 
 
 const int LIST_ITEM_HEIGHT = 58;
-const Image* STRUCTURE_ICONS = nullptr;
+const AtlasImage* STRUCTURE_ICONS = nullptr;
 
 static const Font* MAIN_FONT = nullptr;
 static const Font* MAIN_FONT_BOLD = nullptr;
 
 
+/// \fixme super sloppy
+static NAS2D::Point<int> iconPosition(const Factory& factory)
+{
+	const auto& name = factory.name();
+	return (factory.state() == StructureState::Destroyed) ? NAS2D::Point<int>{414, 368} :
+		(name == constants::UndergroundFactory) ? NAS2D::Point<int>{138, 276} :
+		(name == constants::SeedFactory) ? NAS2D::Point<int>{460, 368} :
+		NAS2D::Point<int>{0, 46}; // Surface factory
+}
+
+
 static void drawItem(Renderer& renderer, FactoryListBox::FactoryListBoxItem& item, int x, int y, int w, int offset, bool highlight)
 {
 	Factory* f = item.factory;
+	const auto iconSlice = iconPosition(*f);
 
 	const auto& structureColor = structureColorFromIndex(f->state());
 	const auto& structureTextColor = structureTextColorFromIndex(f->state());
@@ -32,7 +46,7 @@ static void drawItem(Renderer& renderer, FactoryListBox::FactoryListBoxItem& ite
 	if (highlight) { renderer.drawBoxFilled(NAS2D::Rectangle{x, y - offset, w, LIST_ITEM_HEIGHT}, highlightColor); }
 
 	renderer.drawBox(NAS2D::Rectangle{x + 2, y + 2 - offset, w - 4, LIST_ITEM_HEIGHT - 4}, structureColor);
-	renderer.drawSubImage(*STRUCTURE_ICONS, NAS2D::Point{x + 8, y + 8 - offset}, NAS2D::Rectangle{item.icon_slice.x, item.icon_slice.y, 46, 46}, subImageColor);
+	drawSubImage(renderer, *STRUCTURE_ICONS, NAS2D::Point{x + 8, y + 8 - offset}, NAS2D::Rectangle{iconSlice.x, iconSlice.y, 46, 46}, subImageColor);
 
 	renderer.drawText(*MAIN_FONT_BOLD, f->name(), NAS2D::Point{x + 64, ((y + 29) - MAIN_FONT_BOLD->height() / 2) - offset}, structureTextColor);
 
@@ -47,7 +61,7 @@ static void drawItem(Renderer& renderer, FactoryListBox::FactoryListBoxItem& ite
 FactoryListBox::FactoryListBox()
 {
 	item_height(LIST_ITEM_HEIGHT);
-	STRUCTURE_ICONS = &imageCache.load("ui/structures.png");
+	STRUCTURE_ICONS = &uiAtlas.image("ui/structures.png");
 	MAIN_FONT = &fontCache.load(constants::FONT_PRIMARY, 12);
 	MAIN_FONT_BOLD = &fontCache.load(constants::FONT_PRIMARY_BOLD, 12);
 }
@@ -60,23 +74,70 @@ FactoryListBox::FactoryListBox()
  */
 void FactoryListBox::addItem(Factory* factory)
 {
-	/// \fixme	Could be much more elegant via a lambda expression
-	for (auto item : mItems)
+	if (mItemIndex.count(factory) > 0)
 	{
-		if (static_cast<FactoryListBoxItem*>(item)->factory == factory)
-		{
-			std::cout << "FactoryListBox::addItem(): annoying bug, fix it." << std::endl;
-			return;
-		}
+		std::cout << "FactoryListBox::addItem(): annoying bug, fix it." << std::endl;
+		return;
 	}
 
-	/// \fixme super sloppy
-	const auto& text = factory->name();
-	const auto iconPosition = (factory->state() == StructureState::Destroyed) ? NAS2D::Point<int>{414, 368} :
-		(text == constants::UndergroundFactory) ? NAS2D::Point<int>{138, 276} :
-		(text == constants::SeedFactory) ? NAS2D::Point<int>{460, 368} :
-		NAS2D::Point<int>{0, 46}; // Surface factory
-	add<FactoryListBoxItem>(text, factory, iconPosition);
+	mItemIndex[factory] = &add<FactoryListBoxItem>(factory);
+}
+
+
+/**
+ * Removes a Factory from the FactoryListBox.
+ *
+ * \param	factory	Only used to find its item, never dereferenced.
+ */
+void FactoryListBox::removeItem(Factory* factory)
+{
+	const auto it = mItemIndex.find(factory);
+	if (it == mItemIndex.end()) { return; }
+
+	remove(*it->second);
+	mItemIndex.erase(it);
+}
+
+
+/**
+ * Adds and removes items so the list holds exactly \c factories.
+ *
+ * Items for factories already listed are kept, new factories are added
+ * at the end.
+ */
+void FactoryListBox::sync(const std::vector<Factory*>& factories)
+{
+	const std::unordered_set<Factory*> listed(factories.begin(), factories.end());
+
+	std::vector<Factory*> removed;
+	for (const auto& [factory, item] : mItemIndex)
+	{
+		if (listed.count(factory) == 0) { removed.push_back(factory); }
+	}
+	for (auto factory : removed) { removeItem(factory); }
+
+	for (auto factory : factories)
+	{
+		if (mItemIndex.count(factory) == 0) { addItem(factory); }
+	}
+}
+
+
+/**
+ * Shows only the factories \c factoryFilter returns true for. Every
+ * factory is shown if it's empty.
+ */
+void FactoryListBox::filter(const Filter& factoryFilter)
+{
+	if (!factoryFilter)
+	{
+		ListBoxBase::filter({});
+		return;
+	}
+
+	ListBoxBase::filter([factoryFilter](const ListBoxItem& item) {
+		return factoryFilter(*static_cast<const FactoryListBoxItem&>(item).factory);
+	});
 }
 
 
@@ -87,22 +148,23 @@ void FactoryListBox::addItem(Factory* factory)
  */
 void FactoryListBox::setSelected(Factory* f)
 {
-	if (mItems.empty() || f == nullptr) { return; }
-	for (std::size_t i = 0; i < mItems.size(); ++i)
-	{
-		FactoryListBoxItem* item = static_cast<FactoryListBoxItem*>(mItems[i]);
-		if (item->factory == f)
-		{
-			setSelection(i);
-			return;
-		}
-	}
+	if (isEmpty() || f == nullptr) { return; }
+
+	const auto it = mItemIndex.find(f);
+	if (it != mItemIndex.end()) { setSelection(rowIndex(*it->second)); }
+}
+
+
+void FactoryListBox::clear()
+{
+	ListBoxBase::clear();
+	mItemIndex.clear();
 }
 
 
 Factory* FactoryListBox::selectedFactory()
 {
-	return (selectedIndex() == constants::NoSelection) ? nullptr : static_cast<FactoryListBoxItem*>(mItems[selectedIndex()])->factory;
+	return (selectedIndex() == constants::NoSelection) ? nullptr : static_cast<FactoryListBoxItem*>(mRows[selectedIndex()])->factory;
 }
 
 
@@ -119,9 +181,10 @@ void FactoryListBox::update()
 	renderer.clipRect(mRect);
 
 	// ITEMS
-	for (std::size_t i = 0; i < mItems.size(); ++i)
+	const auto [firstVisible, endVisible] = visibleItemRange();
+	for (std::size_t i = firstVisible; i < endVisible; ++i)
 	{
-		drawItem(renderer, *static_cast<FactoryListBoxItem*>(mItems[i]),
+		drawItem(renderer, *static_cast<FactoryListBoxItem*>(mRows[i]),
 			positionX(),
 			positionY() + (static_cast<int>(i) * LIST_ITEM_HEIGHT),
 			static_cast<int>(item_width()),
@@ -3,10 +3,11 @@
 #include "Core/ListBoxBase.h"
 
 #include <NAS2D/Signal/Signal.h>
-#include <NAS2D/Renderer/Point.h>
 
+#include <functional>
 #include <string>
 #include <vector>
+#include <unordered_map>
 
 
 class Factory;
@@ -20,25 +21,36 @@ class FactoryListBox : public ListBoxBase
 public:
 	using SelectionChangedSignal = NAS2D::Signal<Factory*>;
 
+	using Filter = std::function<bool(const Factory&)>;
+
+	/**
+	 * Row for a Factory. Its text and icon are read from the factory
+	 * when the row is drawn.
+	 */
 	struct FactoryListBoxItem : public ListBoxItem
 	{
-		FactoryListBoxItem(std::string textDescription, Factory* newFactory, NAS2D::Point<int> iconPosition) :
-			ListBoxItem{textDescription},
-			factory{newFactory},
-			icon_slice{iconPosition}
+		FactoryListBoxItem(Factory* newFactory) :
+			factory{newFactory}
 		{}
 
 		Factory* factory = nullptr;
-		NAS2D::Point<int> icon_slice;
 	};
 
 
 	FactoryListBox();
 
 	void addItem(Factory* factory);
+	void removeItem(Factory* factory);
+	void sync(const std::vector<Factory*>& factories);
+	void filter(const Filter& factoryFilter);
 	void setSelected(Factory*);
 
+	void clear() override;
+
 	Factory* selectedFactory();
 
 	void update() override;
+
+private:
+	std::unordered_map<Factory*, FactoryListBoxItem*> mItemIndex; /**< Item of each listed Factory. */
 };
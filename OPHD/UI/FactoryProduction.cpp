@@ -1,6 +1,7 @@
 #include "FactoryProduction.h"
 
 #include "StringTable.h"
+#include "../StructureManager.h"
 #include "../Things/Structures/Factory.h"
 
 #include <NAS2D/Utility.h>
@@ -102,6 +103,7 @@ void FactoryProduction::onCheckBoxIdleChange()
 	if (!mFactory) { return; }
 
 	mFactory->forceIdle(chkIdle.checked());
+	NAS2D::Utility<StructureManager>::get().markChanged();
 }
 
 
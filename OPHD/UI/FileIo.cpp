@@ -2,19 +2,31 @@
 
 #include "../Constants.h"
 #include "../Common.h"
+#include "../Cache.h"
 
 #include <NAS2D/Utility.h>
 #include <NAS2D/Filesystem.h>
 #include <NAS2D/MathUtils.h>
+#include <NAS2D/Renderer/Renderer.h>
 
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <utility>
 
 
 using namespace NAS2D;
 
 
+namespace
+{
+	const auto InfoPanelOffset = NAS2D::Vector{340, 25};
+	const int ThumbnailCellSize = 2;
+}
+
+
 FileIo::FileIo() :
 	Window{"File I/O"},
 	btnClose{"Cancel", {this, &FileIo::onClose}},
@@ -44,7 +56,7 @@ FileIo::FileIo() :
 	txtFileName.textChanged().connect(this, &FileIo::onFileNameChange);
 
 	add(mListBox, {5, 25});
-	mListBox.size({490, 273});
+	mListBox.size({330, 273});
 	mListBox.visible(true);
 	mListBox.selectionChanged().connect(this, &FileIo::onFileSelect);
 }
@@ -104,21 +116,43 @@ void FileIo::setMode(FileOperation fileOp)
 }
 
 
+/**
+ * Starts scanning a directory for savegames.
+ *
+ * The scan runs on a worker thread and only reads each savegame's
+ * info file. The list is filled in by update() once the scan is done.
+ */
 void FileIo::scanDirectory(const std::string& directory)
 {
-	const auto& filesystem = Utility<Filesystem>::get();
-	std::vector<std::string> dirList = filesystem.directoryList(directory);
-	std::sort(dirList.begin(), dirList.end());
+	mListBox.clear();
+	mSavegames.clear();
+
+	mDirectoryScan = std::async(std::launch::async, scanSavegames, directory);
+}
+
+
+/**
+ * Fills the list box once a pending directory scan has finished.
+ */
+void FileIo::checkDirectoryScan()
+{
+	if (!mDirectoryScan.valid()) { return; }
+	if (mDirectoryScan.wait_for(std::chrono::seconds(0)) != std::future_status::ready) { return; }
+
+	try
+	{
+		mSavegames = mDirectoryScan.get();
+	}
+	catch (const std::exception& e)
+	{
+		mSavegames.clear();
+		doNonFatalErrorMessage("Directory Scan Failed", e.what());
+	}
 
 	mListBox.clear();
-	for (auto& dir : dirList)
+	for (const auto& savegame : mSavegames)
 	{
-		if (!filesystem.isDirectory(directory + dir))
-		{
-			// FixMe: Naive approach: Assumes a file save extension of 3 characters.
-			dir.resize(dir.size() - 4);
-			mListBox.add(dir);
-		}
+		mListBox.add(savegame.name);
 	}
 }
 
@@ -177,7 +211,11 @@ void FileIo::onFileDelete()
 	{
 		if(doYesNoMessage(constants::WindowFileIoTitleDelete, "Are you sure you want to delete " + txtFileName.text() + "?"))
 		{
-			Utility<Filesystem>::get().del(filename);
+			auto& filesystem = Utility<Filesystem>::get();
+			filesystem.del(filename);
+
+			const auto infoFilename = savegameInfoPath(filename);
+			if (filesystem.exists(infoFilename)) { filesystem.del(infoFilename); }
 		}
 	}
 	catch(const std::exception& e)
@@ -192,10 +230,65 @@ void FileIo::onFileDelete()
 }
 
 
+/**
+ * Draws the info of the selected savegame to the right of the list.
+ */
+void FileIo::drawSavegameInfo()
+{
+	if (!mListBox.isItemSelected() || mListBox.selectedIndex() >= mSavegames.size()) { return; }
+
+	const auto& info = mSavegames[mListBox.selectedIndex()];
+	auto& renderer = Utility<Renderer>::get();
+	const auto& font = fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal);
+
+	auto position = mRect.startPoint() + InfoPanelOffset;
+	if (!info.hasInfo)
+	{
+		renderer.drawText(font, "No details available", position, NAS2D::Color::White);
+		return;
+	}
+
+	const auto thumbnailArea = NAS2D::Rectangle<int>::Create(position, NAS2D::Vector{info.thumbnailWidth, info.thumbnailHeight} * ThumbnailCellSize);
+	renderer.drawBoxFilled(thumbnailArea, NAS2D::Color::Black);
+	for (int y = 0; y < info.thumbnailHeight; ++y)
+	{
+		for (int x = 0; x < info.thumbnailWidth; ++x)
+		{
+			const auto cell = info.thumbnail[static_cast<std::size_t>(y * info.thumbnailWidth + x)];
+			if (cell == SavegameInfo::ThumbnailEmpty) { continue; }
+
+			const auto color = cell == SavegameInfo::ThumbnailMine ? NAS2D::Color::Yellow : NAS2D::Color::White;
+			renderer.drawBoxFilled(NAS2D::Rectangle{thumbnailArea.x + x * ThumbnailCellSize, thumbnailArea.y + y * ThumbnailCellSize, ThumbnailCellSize, ThumbnailCellSize}, color);
+		}
+	}
+	renderer.drawBox(thumbnailArea, NAS2D::Color{75, 75, 75});
+
+	position.y += thumbnailArea.height + 5;
+	const auto lineHeight = font.height() + 2;
+	const std::array lines
+	{
+		std::pair{std::string{"Planet: "}, info.planet},
+		std::pair{std::string{"Turn: "}, std::to_string(info.turn)},
+		std::pair{std::string{"Population: "}, std::to_string(info.population)},
+		std::pair{std::string{"Structures: "}, std::to_string(info.structureCount)},
+		std::pair{std::string{"Version: "}, info.version},
+	};
+
+	for (const auto& [label, value] : lines)
+	{
+		renderer.drawText(font, label + value, position, NAS2D::Color::White);
+		position.y += lineHeight;
+	}
+}
+
 
 void FileIo::update()
 {
 	if (!visible()) { return; }
 
+	checkDirectoryScan();
+
 	Window::update();
+
+	drawSavegameInfo();
 }
@@ -5,9 +5,14 @@
 #include "Core/TextField.h"
 #include "Core/ListBox.h"
 
+#include "../SavegameInfo.h"
+
 #include <NAS2D/Signal/Signal.h>
 #include <NAS2D/EventHandler.h>
 
+#include <future>
+#include <vector>
+
 
 class FileIo : public Window
 {
@@ -42,6 +47,9 @@ private:
 	void onFileSelect();
 	void onFileNameChange(TextControl* control);
 
+	void checkDirectoryScan();
+	void drawSavegameInfo();
+
 	FileOperationSignal mSignal;
 
 	FileOperation mMode;
@@ -53,4 +61,7 @@ private:
 	TextField txtFileName;
 
 	ListBox<> mListBox;
+
+	std::future<std::vector<SavegameInfo>> mDirectoryScan; /**< Pending background directory scan. */
+	std::vector<SavegameInfo> mSavegames; /**< Info for each entry in mListBox, same order. */
 };
@@ -19,7 +19,7 @@ IconGrid::IconGrid(const std::string& filePath, int iconEdgeSize, int margin) :
 	mFont{fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal)},
 	mIconSize{iconEdgeSize},
 	mIconMargin{margin},
-	mIconSheet{imageCache.load(filePath)},
+	mIconSheet{uiAtlas.image(filePath)},
 	mSkin{
 		imageCache.load("ui/skin/textbox_top_left.png"),
 		imageCache.load("ui/skin/textbox_top_middle.png"),
@@ -177,8 +177,8 @@ void IconGrid::addItemSorted(const std::string& name, int sheetIndex, int meta)
  */
 void IconGrid::addItem(const std::string& name, int sheetIndex, int meta)
 {
-	int x_pos = (sheetIndex % (mIconSheet.size().x / mIconSize)) * mIconSize;
-	int y_pos = (sheetIndex / (mIconSheet.size().x / mIconSize)) * mIconSize;
+	int x_pos = (sheetIndex % (mIconSheet.size.x / mIconSize)) * mIconSize;
+	int y_pos = (sheetIndex / (mIconSheet.size.x / mIconSize)) * mIconSize;
 
 	mIconItemList.push_back(IconGridItem());
 
@@ -393,7 +393,7 @@ void IconGrid::update()
 	{
 		const auto position = indexToGridPosition(i);
 		const auto highlightColor = mIconItemList[i].available ? NAS2D::Color::White : NAS2D::Color::Red;
-		renderer.drawSubImage(mIconSheet, position, NAS2D::Rectangle{mIconItemList[i].pos.x, mIconItemList[i].pos.y, mIconSize, mIconSize}, highlightColor);
+		drawSubImage(renderer, mIconSheet, position, NAS2D::Rectangle{mIconItemList[i].pos.x, mIconItemList[i].pos.y, mIconSize, mIconSize}, highlightColor);
 	}
 
 	if (mSelectedIndex != constants::NoSelection)
@@ -3,6 +3,7 @@
 #include "Core/Control.h"
 
 #include "../Constants/UiConstants.h"
+#include "../TextureAtlas.h"
 
 #include <NAS2D/Signal/Signal.h>
 #include <NAS2D/EventHandler.h>
@@ -112,7 +113,7 @@ private:
 
 	bool mShowTooltip = false; /**< Flag indicating that we want a tooltip drawn near an icon when hovering over it. */
 
-	const NAS2D::Image& mIconSheet; /**< Image containing the icons. */
+	const AtlasImage& mIconSheet; /**< Image containing the icons. */
 
 	NAS2D::RectangleSkin mSkin;
 
@@ -22,7 +22,7 @@ MineOperationsWindow::MineOperationsWindow() :
 	mFont{fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal)},
 	mFontBold{fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryNormal)},
 	mUiIcon{imageCache.load("ui/interface/mine.png")},
-	mIcons{imageCache.load("ui/icons.png")},
+	mIcons{uiAtlas.image("ui/icons.png")},
 	mPanel{
 		imageCache.load("ui/skin/textbox_top_left.png"),
 		imageCache.load("ui/skin/textbox_top_middle.png"),
@@ -88,6 +88,7 @@ void MineOperationsWindow::hide()
 void MineOperationsWindow::mineFacility(MineFacility* facility)
 {
 	mFacility = facility;
+	mTextFacility = nullptr;
 	if (!mFacility) { return; }
 
 	chkCommonMetals.checked(mFacility->mine()->miningCommonMetals());
@@ -112,12 +113,14 @@ void MineOperationsWindow::onExtendShaft()
 {
 	mFacility->extend();
 	btnExtendShaft.enabled(false);
+	NAS2D::Utility<StructureManager>::get().markChanged();
 }
 
 
 void MineOperationsWindow::onIdle()
 {
 	mFacility->forceIdle(btnIdle.toggled());
+	NAS2D::Utility<StructureManager>::get().markChanged();
 }
 
 
@@ -173,6 +176,48 @@ void MineOperationsWindow::onCheckBoxRareMineralsChange()
 void MineOperationsWindow::updateTruckAvailability()
 {
 	mAvailableTrucks = getTruckAvailability();
+	mTextFacility = nullptr;
+}
+
+
+/**
+ * Formats the text shown in the window. Only done when the facility
+ * changes or the StructureManager reports a change so idle frames don't
+ * format anything.
+ */
+void MineOperationsWindow::updateText()
+{
+	const auto changeCount = NAS2D::Utility<StructureManager>::get().changeCount();
+	if (mTextFacility == mFacility && mStructureChangeCount == changeCount) { return; }
+
+	mTextFacility = mFacility;
+	mStructureChangeCount = changeCount;
+
+	const auto& mine = *mFacility->mine();
+
+	mStatusText =
+		mFacility->extending() ? "Digging New Level" :
+		mine.exhausted() ? "Exhausted" :
+		mFacility->stateDescription();
+
+	mTurnsRemainingText = std::to_string(mFacility->digTimeRemaining());
+	mDepthText = std::to_string(mine.depth());
+	mAssignedTrucksText = std::to_string(mFacility->assignedTrucks());
+	mAvailableTrucksText = std::to_string(mAvailableTrucks);
+
+	const std::array oreAvailable
+	{
+		mine.commonMetalsAvailable(),
+		mine.commonMineralsAvailable(),
+		mine.rareMetalsAvailable(),
+		mine.rareMineralsAvailable()
+	};
+
+	for (std::size_t i = 0; i < oreAvailable.size(); ++i)
+	{
+		mOreText[i] = std::to_string(oreAvailable[i]);
+		mOreTextOffsetX[i] = 8 - (mFont.width(mOreText[i]) / 2);
+	}
 }
 
 
@@ -182,6 +227,8 @@ void MineOperationsWindow::update()
 
 	Window::update();
 
+	updateText();
+
 	auto& renderer = Utility<Renderer>::get();
 
 	const auto origin = mRect.startPoint();
@@ -190,26 +237,19 @@ void MineOperationsWindow::update()
 	const auto& mineYield = MINE_YIELD_TRANSLATION.at(mFacility->mine()->productionRate());
 	drawLabelAndValue(origin + NAS2D::Vector{ 148, 30 }, "Mine Yield: ", mineYield);
 
-	const std::string statusString =
-		mFacility->extending() ? "Digging New Level" :
-		mFacility->mine()->exhausted() ? "Exhausted" :
-		mFacility->stateDescription();
+	drawLabelAndValue(origin + NAS2D::Vector{ 148, 45 }, "Status: ", mStatusText);
 
-	drawLabelAndValue(origin + NAS2D::Vector{ 148, 45 }, "Status: ", statusString);
-
-	if (mFacility && mFacility->extending())
+	if (mFacility->extending())
 	{
-		const auto extensionTimeRemaining = std::to_string(mFacility->digTimeRemaining());
-		drawLabelAndValue(origin + NAS2D::Vector{ 148, 60 }, "Turns Remaining: ", extensionTimeRemaining);
+		drawLabelAndValue(origin + NAS2D::Vector{ 148, 60 }, "Turns Remaining: ", mTurnsRemainingText);
 	}
 
-	const auto mineDepth = std::to_string(mFacility->mine()->depth());
-	drawLabelAndValue(origin + NAS2D::Vector{ 300, 30 }, "Depth: ", mineDepth);
+	drawLabelAndValue(origin + NAS2D::Vector{ 300, 30 }, "Depth: ", mDepthText);
 
 	// TRUCK ASSIGNMENT
 	renderer.drawText(mFontBold, "Trucks", origin + NAS2D::Vector{ 148, 80 }, NAS2D::Color::White);
-	drawLabelAndValue(origin + NAS2D::Vector{ 148, 95 }, "Assigned: ", std::to_string(mFacility->assignedTrucks()));
-	drawLabelAndValue(origin + NAS2D::Vector{ 260, 95 }, "Available: ", std::to_string(mAvailableTrucks));
+	drawLabelAndValue(origin + NAS2D::Vector{ 148, 95 }, "Assigned: ", mAssignedTrucksText);
+	drawLabelAndValue(origin + NAS2D::Vector{ 260, 95 }, "Available: ", mAvailableTrucksText);
 
 	// REMAINING ORE PANEL
 	const auto width = mRect.width;
@@ -223,24 +263,18 @@ void MineOperationsWindow::update()
 
 	renderer.drawLine(origin + NAS2D::Vector{ 11, 200 }, origin + NAS2D::Vector{ width - 11, 200 }, NAS2D::Color{ 22, 22, 22 });
 
-	const auto CommonMetalIconRect = NAS2D::Rectangle{ 64, 0, 16, 16 };
-	const auto CommonMineralIconRect = NAS2D::Rectangle{ 96, 0, 16, 16 };
-	const auto RareMetalIconRect = NAS2D::Rectangle{ 80, 0, 16, 16 };
-	const auto RareMineralIconRect = NAS2D::Rectangle{ 112, 0, 16, 16 };
-
 	const std::array resources
 	{
-		std::tuple{46,  CommonMetalIconRect,   mFacility->mine()->commonMetalsAvailable()},
-		std::tuple{135, CommonMineralIconRect, mFacility->mine()->commonMineralsAvailable()},
-		std::tuple{224, RareMetalIconRect,     mFacility->mine()->rareMetalsAvailable()},
-		std::tuple{313, RareMineralIconRect,   mFacility->mine()->rareMineralsAvailable()}
+		std::tuple{46,  NAS2D::Rectangle{ 64, 0, 16, 16 }},
+		std::tuple{135, NAS2D::Rectangle{ 96, 0, 16, 16 }},
+		std::tuple{224, NAS2D::Rectangle{ 80, 0, 16, 16 }},
+		std::tuple{313, NAS2D::Rectangle{ 112, 0, 16, 16 }}
 	};
 
-	for (const auto& [offsetX, iconRect, resourceCount] : resources)
+	for (std::size_t i = 0; i < resources.size(); ++i)
 	{
-		const auto resourceCountString = std::to_string(resourceCount);
-		const auto textOffsetX = offsetX - (mFont.width(resourceCountString) / 2) + 8;
-		renderer.drawSubImage(mIcons, origin + NAS2D::Vector{ offsetX, 183 }, iconRect);
-		renderer.drawText(mFont, resourceCountString, origin + NAS2D::Vector{ textOffsetX, 202 }, NAS2D::Color::White);
+		const auto& [offsetX, iconRect] = resources[i];
+		drawSubImage(renderer, mIcons, origin + NAS2D::Vector{ offsetX, 183 }, iconRect);
+		renderer.drawText(mFont, mOreText[i], origin + NAS2D::Vector{ offsetX + mOreTextOffsetX[i], 202 }, NAS2D::Color::White);
 	}
 }
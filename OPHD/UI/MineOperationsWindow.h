@@ -4,8 +4,13 @@
 #include "Core/Button.h"
 #include "Core/CheckBox.h"
 
+#include "../TextureAtlas.h"
+
 #include <NAS2D/Renderer/RectangleSkin.h>
 
+#include <array>
+#include <string>
+
 
 class MineFacility;
 
@@ -39,13 +44,15 @@ private:
 	void onAssignTruck();
 	void onUnassignTruck();
 
+	void updateText();
+
 	const NAS2D::Font& mFont;
 	const NAS2D::Font& mFontBold;
 
 	MineFacility* mFacility = nullptr;
 
 	const NAS2D::Image& mUiIcon;
-	const NAS2D::Image& mIcons;
+	const AtlasImage& mIcons;
 
 	NAS2D::RectangleSkin mPanel;
 
@@ -62,4 +69,15 @@ private:
 	Button btnUnassignTruck;
 
 	int mAvailableTrucks = 0;
+
+	// Text shown for mTextFacility, rebuilt when the StructureManager reports a change
+	MineFacility* mTextFacility = nullptr;
+	unsigned int mStructureChangeCount = 0;
+	std::string mStatusText;
+	std::string mTurnsRemainingText;
+	std::string mDepthText;
+	std::string mAssignedTrucksText;
+	std::string mAvailableTrucksText;
+	std::array<std::string, 4> mOreText;
+	std::array<int, 4> mOreTextOffsetX{};
 };
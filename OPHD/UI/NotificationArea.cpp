@@ -56,7 +56,7 @@ static constexpr int Offset = constants::MarginTight + 32;
 
 
 NotificationArea::NotificationArea() :
-	mIcons{ imageCache.load("ui/icons.png") },
+	mIcons{ uiAtlas.image("ui/icons.png") },
 	mFont{ fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal) }
 {
 	auto& eventhandler = Utility<EventHandler>::get();
@@ -185,8 +185,8 @@ void NotificationArea::update()
 	{
 		auto& rect = mNotificationRectList.at(count);
 
-		renderer.drawSubImage(mIcons, rect.startPoint(), { 128, 64, 32, 32 }, NotificationIconColor.at(notification.type));
-		renderer.drawSubImage(mIcons, rect.startPoint(), NotificationIconRect.at(notification.type), Color::Normal);
+		drawSubImage(renderer, mIcons, rect.startPoint(), { 128, 64, 32, 32 }, NotificationIconColor.at(notification.type));
+		drawSubImage(renderer, mIcons, rect.startPoint(), NotificationIconRect.at(notification.type), Color::Normal);
 
 		if (mNotificationIndex == count)
 		{
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Control.h"
+#include "../TextureAtlas.h"
 
 
 #include <vector>
@@ -65,7 +66,7 @@ protected:
 private:
 	void updateRectListPositions();
 
-	const NAS2D::Image& mIcons;
+	const AtlasImage& mIcons;
 	const NAS2D::Font& mFont;
 
 	std::vector<Notification> mNotificationList;
@@ -11,7 +11,7 @@ using namespace NAS2D;
 
 
 NotificationWindow::NotificationWindow():
-	mIcons{ imageCache.load("ui/icons.png") }
+	mIcons{ uiAtlas.image("ui/icons.png") }
 {
 	size({ 300, 220 });
 
@@ -65,6 +65,6 @@ void NotificationWindow::update()
 
 	Point<float> iconLocation = position() + Vector{ 10, 30 };
 
-	renderer.drawSubImage(mIcons, iconLocation, { 128, 64, 32, 32 }, ColorFromNotification(mNotification.type));
-	renderer.drawSubImage(mIcons, iconLocation, IconRectFromNotificationType(mNotification.type), Color::Normal);
+	drawSubImage(renderer, mIcons, iconLocation, { 128, 64, 32, 32 }, ColorFromNotification(mNotification.type));
+	drawSubImage(renderer, mIcons, iconLocation, IconRectFromNotificationType(mNotification.type), Color::Normal);
 }
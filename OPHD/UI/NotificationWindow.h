@@ -26,7 +26,7 @@ private:
 	void btnOkayClicked();
 	void btnTakeMeThereClicked();
 
-	const NAS2D::Image& mIcons;
+	const AtlasImage& mIcons;
 
 	NotificationArea::Notification mNotification;
 	Button btnOkay{ "Okay", {this, &NotificationWindow::btnOkayClicked} };
@@ -3,6 +3,7 @@
 #include "../Cache.h"
 #include "../Common.h"
 #include "../Constants.h"
+#include "../StructureManager.h"
 #include "../Population/Population.h"
 
 #include <NAS2D/Utility.h>
@@ -48,7 +49,7 @@ static const std::array moraleStringColor
 PopulationPanel::PopulationPanel() :
 	mFont{ fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal) },
 	mFontBold{ fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryNormal) },
-	mIcons{ imageCache.load("ui/icons.png") },
+	mIcons{ uiAtlas.image("ui/icons.png") },
 	mSkin
 	{
 		imageCache.load("ui/skin/window_top_left.png"),
@@ -87,8 +88,56 @@ PopulationPanel::PopulationPanel() :
 }
 
 
+/**
+ * Formats the panel's text. Only done when a value shown changes or the
+ * StructureManager reports a change, which it does at the end of every
+ * turn, so idle frames don't format anything.
+ */
+void PopulationPanel::updateText()
+{
+	const auto changeCount = Utility<StructureManager>::get().changeCount();
+	if (mTextValid && mStructureChangeCount == changeCount) { return; }
+
+	mTextValid = true;
+	mStructureChangeCount = changeCount;
+
+	const std::array roleCounts
+	{
+		mPopulation->size(PopulationTable::Role::Child),
+		mPopulation->size(PopulationTable::Role::Student),
+		mPopulation->size(PopulationTable::Role::Worker),
+		mPopulation->size(PopulationTable::Role::Scientist),
+		mPopulation->size(PopulationTable::Role::Retired)
+	};
+
+	for (std::size_t i = 0; i < roleCounts.size(); ++i)
+	{
+		mRoleCountText[i] = std::to_string(roleCounts[i]);
+		mRoleCountWidth[i] = mFont.width(mRoleCountText[i]);
+	}
+
+	mMoraleLevelText = moraleString(Morale::Description) + moraleString(moraleIndex(mMorale));
+	mMoraleText = "Current: " + std::to_string(mMorale) + " / Previous: " + std::to_string(mPreviousMorale);
+
+	const int capacityPercent = (mResidentialCapacity > 0) ? (mPopulation->size() * 100 / mResidentialCapacity) : 0;
+	mHousingText = "Housing: " + std::to_string(mPopulation->size()) + " / " + std::to_string(mResidentialCapacity) + "  (" + std::to_string(capacityPercent) + "%)";
+
+	mCrimeRateText = "Mean Crime Rate: " + std::to_string(mCrimeRate) + "%";
+
+	mMoraleChangeText.clear();
+	mMoraleChangeWidth.clear();
+	for (const auto& item : mMoraleChangeReasons)
+	{
+		mMoraleChangeText.push_back(formatDiff(item.second));
+		mMoraleChangeWidth.push_back(mFont.width(mMoraleChangeText.back()));
+	}
+}
+
+
 void PopulationPanel::update()
 {
+	updateText();
+
 	auto& renderer = Utility<Renderer>::get();
 	mSkin.draw(renderer, mRect);
 
@@ -101,24 +150,24 @@ void PopulationPanel::update()
 	renderer.drawText(mFontBold, constants::PopulationBreakdown, position);
 	const std::array populationData
 	{
-		std::tuple{NAS2D::Rectangle{0, 96, IconSize, IconSize}, mPopulation->size(PopulationTable::Role::Child), std::string("Children")},
-		std::tuple{NAS2D::Rectangle{32, 96, IconSize, IconSize}, mPopulation->size(PopulationTable::Role::Student), std::string("Students")},
-		std::tuple{NAS2D::Rectangle{64, 96, IconSize, IconSize}, mPopulation->size(PopulationTable::Role::Worker), std::string("Workers")},
-		std::tuple{NAS2D::Rectangle{96, 96, IconSize, IconSize}, mPopulation->size(PopulationTable::Role::Scientist), std::string("Scientists")},
-		std::tuple{NAS2D::Rectangle{128, 96, IconSize, IconSize}, mPopulation->size(PopulationTable::Role::Retired), std::string("Retired")},
+		std::tuple{NAS2D::Rectangle{0, 96, IconSize, IconSize}, "Children: "},
+		std::tuple{NAS2D::Rectangle{32, 96, IconSize, IconSize}, "Students: "},
+		std::tuple{NAS2D::Rectangle{64, 96, IconSize, IconSize}, "Workers: "},
+		std::tuple{NAS2D::Rectangle{96, 96, IconSize, IconSize}, "Scientists: "},
+		std::tuple{NAS2D::Rectangle{128, 96, IconSize, IconSize}, "Retired: "},
 	};
 
 	position.y += fontBoldHeight + constants::Margin;
 	const auto textOffset = NAS2D::Vector{ IconSize + constants::Margin, (IconSize / 2) - (fontHeight / 2) };
-	for (const auto& [imageRect, personCount, personRole] : populationData)
+	for (std::size_t i = 0; i < populationData.size(); ++i)
 	{
-		renderer.drawSubImage(mIcons, position, imageRect);
-	
-		const auto roleCount = std::to_string(personCount);
-		renderer.drawText(mFont, personRole + ": ", position + textOffset);
+		const auto& [imageRect, personRole] = populationData[i];
+		drawSubImage(renderer, mIcons, position, imageRect);
+
+		renderer.drawText(mFont, personRole, position + textOffset);
 
-		const NAS2D::Point<int> labelPosition = { positionX() + mPopulationPanelWidth - mFont.width(roleCount) - constants::Margin , position.y + textOffset.y };
-		renderer.drawText(mFont, roleCount, labelPosition);
+		const NAS2D::Point<int> labelPosition = { positionX() + mPopulationPanelWidth - mRoleCountWidth[i] - constants::Margin , position.y + textOffset.y };
+		renderer.drawText(mFont, mRoleCountText[i], labelPosition);
 		position.y += IconSize + constants::Margin;
 	}
 
@@ -131,19 +180,16 @@ void PopulationPanel::update()
 	renderer.drawText(mFontBold, constants::MoraleBreakdown, position);
 
 	position.y += fontBoldHeight;
-	const auto moraleLevel = moraleIndex(mMorale);
-	renderer.drawText(mFont, moraleString(Morale::Description) + moraleString(moraleLevel), position, moraleStringColor[moraleLevel]);
+	renderer.drawText(mFont, mMoraleLevelText, position, moraleStringColor[moraleIndex(mMorale)]);
 
 	position.y += fontHeight;
-	renderer.drawText(mFont, "Current: " + std::to_string(mMorale) + " / Previous: " + std::to_string(mPreviousMorale), position);
+	renderer.drawText(mFont, mMoraleText, position);
 
 	position.y += fontHeight;
-	int capacityPercent = (mResidentialCapacity > 0) ? (mPopulation->size() * 100 / mResidentialCapacity) : 0;
-	const auto housingText = "Housing: " + std::to_string(mPopulation->size()) + " / " + std::to_string(mResidentialCapacity) + "  (" + std::to_string(capacityPercent) + "%)";
-	renderer.drawText(mFont, housingText, position, NAS2D::Color::White);
+	renderer.drawText(mFont, mHousingText, position, NAS2D::Color::White);
 
 	position.y += fontHeight;
-	renderer.drawText(mFont, "Mean Crime Rate: " + std::to_string(mCrimeRate) + "%", position, NAS2D::Color::White);
+	renderer.drawText(mFont, mCrimeRateText, position, NAS2D::Color::White);
 
 	position.y += fontHeight + fontHeight / 2;
 
@@ -151,14 +197,14 @@ void PopulationPanel::update()
 
 	position.y += fontHeight / 2;	
 	
-	for (auto& item : mMoraleChangeReasons)
+	for (std::size_t i = 0; i < mMoraleChangeReasons.size(); ++i)
 	{
+		const auto& item = mMoraleChangeReasons[i];
 		renderer.drawText(mFont, item.first, position);
 
-		const auto text = formatDiff(item.second);
-		const NAS2D::Point<int> labelPosition = { rect().x + rect().width - mFont.width(text) - 5 , position.y };
+		const NAS2D::Point<int> labelPosition = { rect().x + rect().width - mMoraleChangeWidth[i] - 5 , position.y };
 
-		renderer.drawText(mFont, text, labelPosition, trend[trendIndex(item.second)]);
+		renderer.drawText(mFont, mMoraleChangeText[i], labelPosition, trend[trendIndex(item.second)]);
 		position.y += fontHeight;
 	}
 }
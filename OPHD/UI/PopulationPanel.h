@@ -2,9 +2,13 @@
 
 #include "Core/Control.h"
 
+#include "../TextureAtlas.h"
+
 #include <NAS2D/Resource/Font.h>
 #include <NAS2D/Renderer/RectangleSkin.h>
 
+#include <array>
+#include <string>
 #include <vector>
 
 class Population;
@@ -15,32 +19,35 @@ class PopulationPanel : public Control
 public:
 	PopulationPanel();
 
-	void population(Population* pop) { mPopulation = pop; }
+	void population(Population* pop) { mPopulation = pop; mTextValid = false; }
 
-	void morale(int val) { mMorale = val; }
-	void old_morale(int val) { mPreviousMorale = val; }
+	void morale(int val) { mMorale = val; mTextValid = false; }
+	void old_morale(int val) { mPreviousMorale = val; mTextValid = false; }
 
-	void residentialCapacity(int val) { mResidentialCapacity = val; }
+	void residentialCapacity(int val) { mResidentialCapacity = val; mTextValid = false; }
 
-	void crimeRate(int val) { mCrimeRate = val; }
+	void crimeRate(int val) { mCrimeRate = val; mTextValid = false; }
 	int crimeRate() const { return mCrimeRate; }
 
 	void addMoraleReason(const std::string& str, int val)
 	{
 		if (val == 0) { return; }
 		mMoraleChangeReasons.push_back(std::make_pair(str, val));
+		mTextValid = false;
 	}
 
 	const auto& moraleReasonList() const { return mMoraleChangeReasons; }
 
-	void clearMoraleReasons() { mMoraleChangeReasons.clear(); }
+	void clearMoraleReasons() { mMoraleChangeReasons.clear(); mTextValid = false; }
 
 	void update() override;
 
 private:
+	void updateText();
+
 	const NAS2D::Font& mFont;
 	const NAS2D::Font& mFontBold;
-	const NAS2D::Image& mIcons;
+	const AtlasImage& mIcons;
 	NAS2D::RectangleSkin mSkin;
 
 	std::vector<std::pair<std::string,int>> mMoraleChangeReasons;
@@ -52,4 +59,16 @@ private:
 	int mResidentialCapacity{ 0 };
 	int mCrimeRate{ 0 };
 	int mPopulationPanelWidth{ 0 };
+
+	// Formatted text, rebuilt when a value above changes or the StructureManager reports a change
+	bool mTextValid = false;
+	unsigned int mStructureChangeCount = 0;
+	std::array<std::string, 5> mRoleCountText;
+	std::array<int, 5> mRoleCountWidth{};
+	std::string mMoraleLevelText;
+	std::string mMoraleText;
+	std::string mHousingText;
+	std::string mCrimeRateText;
+	std::vector<std::string> mMoraleChangeText;
+	std::vector<int> mMoraleChangeWidth;
 };
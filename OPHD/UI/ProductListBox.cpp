@@ -35,15 +35,12 @@ void ProductListBox::productPool(ProductPool& pool)
 
 		if (productCount > 0)
 		{
-			ProductListBoxItem* item = new ProductListBoxItem();
-			item->text = productDescription(productType);
-			item->count = productCount;
-			item->usage = static_cast<float>(productCount * pool.productStorageRequirement(productType)) / static_cast<float>(pool.capacity());
-			mItems.push_back(item);
+			auto& item = add<ProductListBoxItem>();
+			item.text = productDescription(productType);
+			item.count = productCount;
+			item.usage = static_cast<float>(productCount * pool.productStorageRequirement(productType)) / static_cast<float>(pool.capacity());
 		}
 	}
-
-	updateScrollLayout();
 }
 
 
@@ -68,9 +65,10 @@ void ProductListBox::update()
 	const auto offset = static_cast<int>(draw_offset());
 	const auto x = positionX();
 
-	for (std::size_t i = 0; i < mItems.size(); ++i)
+	const auto [firstVisible, endVisible] = visibleItemRange();
+	for (std::size_t i = firstVisible; i < endVisible; ++i)
 	{
-		const auto& item = *static_cast<ProductListBoxItem*>(mItems[i]);
+		const auto& item = *static_cast<ProductListBoxItem*>(mRows[i]);
 		const auto y = positionY() + (static_cast<int>(i) * itemSize.y);
 		const auto highlight = i == selectedIndex();
 
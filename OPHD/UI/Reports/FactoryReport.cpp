@@ -158,11 +158,8 @@ void FactoryReport::refresh()
 void FactoryReport::fillLists()
 {
 	selectedFactory = nullptr;
-	lstFactoryList.clear();
-	for (auto factory : Utility<StructureManager>::get().getStructures<Factory>())
-	{
-		lstFactoryList.addItem(factory);
-	}
+	lstFactoryList.sync(Utility<StructureManager>::get().getStructures<Factory>());
+	lstFactoryList.filter({});
 	checkFactoryActionControls();
 }
 
@@ -173,15 +170,7 @@ void FactoryReport::fillLists()
 void FactoryReport::fillFactoryList(ProductType type)
 {
 	selectedFactory = nullptr;
-	lstFactoryList.clear();
-	for (auto factory : Utility<StructureManager>::get().getStructures<Factory>())
-	{
-		if (factory->productType() == type)
-		{
-			lstFactoryList.addItem(factory);
-		}
-	}
-
+	lstFactoryList.filter([type](const Factory& factory) { return factory.productType() == type; });
 	checkFactoryActionControls();
 }
 
@@ -192,18 +181,10 @@ void FactoryReport::fillFactoryList(ProductType type)
 void FactoryReport::fillFactoryList(bool surface)
 {
 	selectedFactory = nullptr;
-	lstFactoryList.clear();
-	for (auto factory : Utility<StructureManager>::get().getStructures<Factory>())
-	{
-		if (surface && (factory->name() == constants::SurfaceFactory || factory->name() == constants::SeedFactory))
-		{
-			lstFactoryList.addItem(factory);
-		}
-		else if (!surface && factory->name() == constants::UndergroundFactory)
-		{
-			lstFactoryList.addItem(factory);
-		}
-	}
+	lstFactoryList.filter([surface](const Factory& factory) {
+		if (surface) { return factory.name() == constants::SurfaceFactory || factory.name() == constants::SeedFactory; }
+		return factory.name() == constants::UndergroundFactory;
+	});
 
 	checkFactoryActionControls();
 }
@@ -215,14 +196,7 @@ void FactoryReport::fillFactoryList(bool surface)
 void FactoryReport::fillFactoryList(StructureState state)
 {
 	selectedFactory = nullptr;
-	lstFactoryList.clear();
-	for (auto factory : Utility<StructureManager>::get().getStructures<Factory>())
-	{
-		if (factory->state() == state)
-		{
-			lstFactoryList.addItem(factory);
-		}
-	}
+	lstFactoryList.filter([state](const Factory& factory) { return factory.state() == state; });
 
 	lstFactoryList.setSelection(0);
 	checkFactoryActionControls();
@@ -355,6 +329,7 @@ void FactoryReport::onShowDisabled()
 void FactoryReport::onIdle()
 {
 	selectedFactory->forceIdle(btnIdle.toggled());
+	NAS2D::Utility<StructureManager>::get().markChanged();
 }
 
 
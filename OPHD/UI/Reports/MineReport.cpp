@@ -29,7 +29,7 @@ MineReport::MineReport() :
 	fontMediumBold{ fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryMedium) },
 	fontBigBold{ fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryHuge) },
 	mineFacility{ imageCache.load("ui/interface/mine.png") },
-	uiIcons{ imageCache.load("ui/icons.png") },
+	uiIcons{ uiAtlas.image("ui/icons.png") },
 	btnShowAll{ "All", {this, &MineReport::onShowAll} },
 	btnShowActive{ "Active", {this, &MineReport::onShowActive} },
 	btnShowIdle{ "Idle", {this, &MineReport::onShowIdle} },
@@ -58,6 +58,13 @@ MineReport::MineReport() :
 
 	btnShowAll.toggle(true);
 
+	/**
+	 * Number the facilities to avoid a monotonous look in the structure list.
+	 * Since numeric structure ID's were done away with this is purely a cosmetic thing
+	 * that could haunt us later if the player is looking to search for a mine by id
+	 * as these are going to change between play/save/load sessions.
+	 */
+	lstMineFacilities.numbered(true);
 	lstMineFacilities.selectionChanged().connect(this, &MineReport::onMineFacilitySelectionChange);
 	add(lstMineFacilities, {10, 40});
 
@@ -115,22 +122,7 @@ void MineReport::refresh()
 
 void MineReport::fillLists()
 {
-	lstMineFacilities.clear();
-	std::size_t id = 1;
-	for (auto facility : NAS2D::Utility<StructureManager>::get().getStructures<MineFacility>())
-	{
-		lstMineFacilities.addItem(facility);
-
-		/**
-		 * Add a numeric ID to the text to avoid a monotonous look in the structure list.
-		 * Since numeric structure ID's were done away with this is purely a cosmetic thing
-		 * that could haunt us later if the player is looking to search for a mine by id
-		 * as these are going to change between play/save/load sessions and most during
-		 * gameplay as well since list position is not guaranteed.
-		 */
-		lstMineFacilities.last()->text = facility->name() + " #" + std::to_string(id);
-		++id;
-	}
+	lstMineFacilities.sync(NAS2D::Utility<StructureManager>::get().getStructures<MineFacility>());
 
 	mSelectedFacility == nullptr ? lstMineFacilities.setSelection(0) : lstMineFacilities.setSelected(mSelectedFacility);
 	mAvailableTrucks = getTruckAvailability();
@@ -217,6 +209,7 @@ void MineReport::onShowDisabled()
 void MineReport::onIdle()
 {
 	mSelectedFacility->forceIdle(btnIdle.toggled());
+	NAS2D::Utility<StructureManager>::get().markChanged();
 }
 
 
@@ -224,6 +217,7 @@ void MineReport::onDigNewLevel()
 {
 	auto facility = static_cast<MineFacility*>(mSelectedFacility);
 	facility->extend();
+	NAS2D::Utility<StructureManager>::get().markChanged();
 
 	btnDigNewLevel.toggle(facility->extending());
 	btnDigNewLevel.enabled(facility->canExtend());
@@ -345,8 +339,7 @@ void MineReport::drawMineFacilityPane(const NAS2D::Point<int>& origin)
 	const auto textColor = NAS2D::Color{ 0, 185, 0 };
 
 	r.drawImage(mineFacility, origin);
-	const auto text = lstMineFacilities.isItemSelected() ? lstMineFacilities.selected().text : "";
-	r.drawText(fontBigBold, text, origin + NAS2D::Vector{ 0, -33 }, textColor);
+	r.drawText(fontBigBold, lstMineFacilities.selectedText(), origin + NAS2D::Vector{ 0, -33 }, textColor);
 
 	r.drawText(fontMediumBold, "Status", origin + NAS2D::Vector{ 138, 0 }, textColor);
 
@@ -387,7 +380,7 @@ void MineReport::drawOreProductionPane(const NAS2D::Point<int>& origin)
 	const int barWidth = renderer.size().x - origin.x - 10;
 	for (size_t i = 0; i < 4; ++i)
 	{
-		renderer.drawSubImage(uiIcons, origin + NAS2D::Vector{ 0, 30 + offsetY }, NAS2D::Rectangle{ 64, 0, 16, 16 });
+		drawSubImage(renderer, uiIcons, origin + NAS2D::Vector{ 0, 30 + offsetY }, NAS2D::Rectangle{ 64, 0, 16, 16 });
 		renderer.drawText(fontBold, ResourceNamesOre[0], origin + NAS2D::Vector{ 20, 30 + offsetY }, textColor);
 
 		const auto percent = static_cast<float>(mine.oreAvailable(i)) / static_cast<float>(mine.oreTotalYield(i));
@@ -424,8 +417,8 @@ void MineReport::drawTruckMangementPane(const NAS2D::Point<int>& origin)
 	drawLabelAndValueRightJustify(origin + NAS2D::Vector{ 0, 30 }, labelWidth, "Trucks Assigned to Facility", std::to_string(miningFacility->assignedTrucks()), textColor);
 	drawLabelAndValueRightJustify(origin + NAS2D::Vector{ 0, 45 }, labelWidth, "Trucks Available in Storage", std::to_string(mAvailableTrucks), textColor);
 
-	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
-	bool routeAvailable = routeTable.find(miningFacility) != routeTable.end();
+	auto& routeTable = NAS2D::Utility<RouteTable>::get();
+	bool routeAvailable = routeTable.find(PoolHandle<MineFacility>{miningFacility}) != routeTable.end();
 
 	if (miningFacility->operational() || miningFacility->isIdle())
 	{
@@ -447,10 +440,10 @@ void MineReport::drawTruckHaulInfo(const NAS2D::Point<int>& origin)
 {
 	auto& r = Utility<Renderer>::get();
 	const auto textColor = NAS2D::Color{ 0, 185, 0 };
-	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
+	auto& routeTable = NAS2D::Utility<RouteTable>::get();
 	const auto mFacility = static_cast<MineFacility*>(mSelectedFacility);
 
-	auto& route = routeTable[mFacility];
+	auto& route = routeTable[PoolHandle<MineFacility>{mFacility}];
 	drawLabelAndValueRightJustify(origin,
 		btnAddTruck.positionX() - origin.x - 10,
 		"Route Cost",
@@ -8,6 +8,7 @@
 #include "../Core/TextArea.h"
 #include "../StructureListBox.h"
 #include "../../Common.h"
+#include "../../TextureAtlas.h"
 
 #include <NAS2D/Renderer/Rectangle.h>
 
@@ -74,7 +75,7 @@ private:
 	const NAS2D::Font& fontBigBold;
 
 	const NAS2D::Image& mineFacility;
-	const NAS2D::Image& uiIcons;
+	const AtlasImage& uiIcons;
 
 	Button btnShowAll;
 	Button btnShowActive;
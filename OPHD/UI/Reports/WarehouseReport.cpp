@@ -1,6 +1,7 @@
 #include "WarehouseReport.h"
 
 #include "../../Cache.h"
+#include "../../ColonyStatistics.h"
 #include "../../Constants.h"
 #include "../../StructureManager.h"
 #include "../../Things/Structures/Structure.h"
@@ -19,14 +20,23 @@ using namespace NAS2D;
 namespace
 {
 	template <typename Predicate>
-	std::vector<Warehouse*> selectWarehouses(const Predicate& predicate)
+	StructureListBox::Filter warehouseFilter(const Predicate& predicate)
 	{
-		const auto& warehouses = Utility<StructureManager>::get().getStructures<Warehouse>();
+		return [predicate](const Structure& structure) { return predicate(static_cast<const Warehouse&>(structure)); };
+	}
+
+
+	std::string warehouseStateText(const Structure& structure)
+	{
+		const auto& warehouse = static_cast<const Warehouse&>(structure);
 
-		std::vector<Warehouse*> output;
-		std::copy_if(warehouses.begin(), warehouses.end(), std::back_inserter(output), predicate);
+		// \fixme	Abuse of interface to achieve custom results.
+		const auto& products = warehouse.products();
 
-		return output;
+		if (warehouse.state() != StructureState::Operational) { return warehouse.stateDescription(); }
+		else if (products.empty()) { return constants::WarehouseEmpty; }
+		else if (products.atCapacity()) { return constants::WarehouseFull; }
+		return constants::WarehouseSpaceAvailable;
 	}
 }
 
@@ -56,6 +66,7 @@ WarehouseReport::WarehouseReport() :
 
 	btnTakeMeThere.size({140, 30});
 
+	lstStructures.stateText(warehouseStateText);
 	lstStructures.selectionChanged().connect(this, &WarehouseReport::onStructureSelectionChange);
 
 	Utility<EventHandler>::get().mouseDoubleClick().connect(this, &WarehouseReport::onDoubleClick);
@@ -81,50 +92,14 @@ WarehouseReport::~WarehouseReport()
 }
 
 
-void WarehouseReport::computeTotalWarehouseCapacity()
-{
-	int capacityTotal = 0;
-	int capacityAvailable = 0;
-
-	const auto& warehouses = Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouses)
-	{
-		if (warehouse->operational())
-		{
-			const auto& warehouseProducts = warehouse->products();
-			capacityAvailable += warehouseProducts.availableStorage();
-			capacityTotal += warehouseProducts.capacity();
-		}
-	}
-
-	int capacityUsed = capacityTotal - capacityAvailable;
-
-	warehouseCount = warehouses.size();
-	warehouseCapacityTotal = capacityTotal;
-	warehouseCapacityPercent = static_cast<float>(capacityUsed) / static_cast<float>(capacityTotal);
-}
-
-
-void WarehouseReport::fillListFromStructureList(const std::vector<Warehouse*>& warehouses)
+/**
+ * Shows only the warehouses \c filter returns true for. The list itself
+ * is kept up to date by fillLists().
+ */
+void WarehouseReport::filterList(const StructureListBox::Filter& filter)
 {
-	lstStructures.clear();
-
-	for (auto warehouse : warehouses)
-	{
-		lstStructures.addItem(warehouse);
-		StructureListBox::StructureListBoxItem* item = lstStructures.last();
-
-		// \fixme	Abuse of interface to achieve custom results.
-		ProductPool& products = warehouse->products();
-
-		if (warehouse->state() != StructureState::Operational) { item->structureState = warehouse->stateDescription(); }
-		else if (products.empty()) { item->structureState = constants::WarehouseEmpty; }
-		else if (products.atCapacity()) { item->structureState = constants::WarehouseFull; }
-		else if (!products.empty() && !products.atCapacity()) { item->structureState = constants::WarehouseSpaceAvailable; }
-	}
-
+	lstStructures.filter(filter);
 	lstStructures.setSelection(0);
-	computeTotalWarehouseCapacity();
 }
 
 
@@ -134,48 +109,49 @@ void WarehouseReport::fillListFromStructureList(const std::vector<Warehouse*>& w
  */
 void WarehouseReport::fillLists()
 {
-	fillListFromStructureList(selectWarehouses([](Warehouse*) { return true; }));
+	lstStructures.sync(Utility<StructureManager>::get().getStructures<Warehouse>());
+	filterList({});
 }
 
 
 void WarehouseReport::fillListSpaceAvailable()
 {
-	const auto predicate = [](Warehouse* wh) {
-		return !wh->products().atCapacity() && !wh->products().empty() && (wh->operational() || wh->isIdle());
+	const auto predicate = [](const Warehouse& wh) {
+		return !wh.products().atCapacity() && !wh.products().empty() && (wh.operational() || wh.isIdle());
 	};
 
-	fillListFromStructureList(selectWarehouses(predicate));
+	filterList(warehouseFilter(predicate));
 }
 
 
 
 void WarehouseReport::fillListFull()
 {
-	const auto predicate = [](Warehouse* wh) {
-		return wh->products().atCapacity() && (wh->operational() || wh->isIdle());
+	const auto predicate = [](const Warehouse& wh) {
+		return wh.products().atCapacity() && (wh.operational() || wh.isIdle());
 	};
 
-	fillListFromStructureList(selectWarehouses(predicate));
+	filterList(warehouseFilter(predicate));
 }
 
 
 void WarehouseReport::fillListEmpty()
 {
-	const auto predicate = [](Warehouse* wh) {
-		return wh->products().empty() && (wh->operational() || wh->isIdle());
+	const auto predicate = [](const Warehouse& wh) {
+		return wh.products().empty() && (wh.operational() || wh.isIdle());
 	};
 
-	fillListFromStructureList(selectWarehouses(predicate));
+	filterList(warehouseFilter(predicate));
 }
 
 
 void WarehouseReport::fillListDisabled()
 {
-	const auto predicate = [](Warehouse* structure) {
-		return structure->disabled() || structure->destroyed();
+	const auto predicate = [](const Warehouse& structure) {
+		return structure.disabled() || structure.destroyed();
 	};
 
-	fillListFromStructureList(selectWarehouses(predicate));
+	filterList(warehouseFilter(predicate));
 }
 
 
@@ -304,8 +280,12 @@ void WarehouseReport::drawLeftPanel(Renderer& renderer)
 	renderer.drawText(fontMediumBold, "Total Storage", NAS2D::Point{10, positionY() + 62}, textColor);
 	renderer.drawText(fontMediumBold, "Capacity Used", NAS2D::Point{10, positionY() + 84}, textColor);
 
-	const auto warehouseCountText = std::to_string(warehouseCount);
-	const auto warehouseCapacityText = std::to_string(warehouseCapacityTotal);
+	const auto& colonyTotals = Utility<ColonyStatistics>::get().totals();
+	const auto warehouseCapacityPercent = colonyTotals.warehouseCapacity > 0 ?
+		static_cast<float>(colonyTotals.warehouseCapacityUsed) / static_cast<float>(colonyTotals.warehouseCapacity) : 0.0f;
+
+	const auto warehouseCountText = std::to_string(colonyTotals.warehouseCount);
+	const auto warehouseCapacityText = std::to_string(colonyTotals.warehouseCapacity);
 	const auto countTextWidth = fontMedium.width(warehouseCountText);
 	const auto capacityTextWidth = fontMedium.width(warehouseCapacityText);
 	renderer.drawText(fontMedium, warehouseCountText, NAS2D::Point{mRect.width / 2 - 10 - countTextWidth, positionY() + 35}, textColor);
@@ -34,9 +34,8 @@ public:
 	void update() override;
 
 private:
-	void computeTotalWarehouseCapacity();
 
-	void fillListFromStructureList(const std::vector<Warehouse*>&);
+	void filterList(const StructureListBox::Filter&);
 
 	void onResize() override;
 
@@ -79,8 +78,4 @@ private:
 
 	StructureListBox lstStructures;
 	ProductListBox lstProducts;
-
-	std::size_t warehouseCount;
-	int warehouseCapacityTotal;
-	float warehouseCapacityPercent = 0.0f;
 };
@@ -16,7 +16,7 @@ using namespace NAS2D;
 
 ResourceBreakdownPanel::ResourceBreakdownPanel() :
 	mFont{fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal)},
-	mIcons{imageCache.load("ui/icons.png")},
+	mIcons{uiAtlas.image("ui/icons.png")},
 	mSkin{
 		imageCache.load("ui/skin/window_top_left.png"),
 		imageCache.load("ui/skin/window_top_middle.png"),
@@ -33,8 +33,31 @@ ResourceBreakdownPanel::ResourceBreakdownPanel() :
 }
 
 
+/**
+ * Formats the resource values and their changes. Only done when one of
+ * them changes so idle frames don't format anything.
+ */
+void ResourceBreakdownPanel::updateText()
+{
+	if (mTextValid && mTextResources.resources == mPlayerResources->resources && mTextPreviousResources.resources == mPreviousResources.resources) { return; }
+
+	mTextValid = true;
+	mTextResources = *mPlayerResources;
+	mTextPreviousResources = mPreviousResources;
+
+	for (std::size_t i = 0; i < mValueText.size(); ++i)
+	{
+		mValueText[i] = std::to_string(mTextResources.resources[i]);
+		mValueWidth[i] = mFont.width(mValueText[i]);
+		mDiffText[i] = formatDiff(mTextResources.resources[i] - mTextPreviousResources.resources[i]);
+	}
+}
+
+
 void ResourceBreakdownPanel::update()
 {
+	updateText();
+
 	auto& renderer = Utility<Renderer>::get();
 	mSkin.draw(renderer, mRect);
 
@@ -56,23 +79,25 @@ void ResourceBreakdownPanel::update()
 
 	const std::array resources
 	{
-		std::tuple{commonMetalImageRect, ResourceNamesRefined[0], mPlayerResources->resources[0], mPreviousResources.resources[0]},
-		std::tuple{rareMetalImageRect, ResourceNamesRefined[2], mPlayerResources->resources[2], mPreviousResources.resources[2]},
-		std::tuple{commonMineralImageRect, ResourceNamesRefined[1], mPlayerResources->resources[1], mPreviousResources.resources[1]},
-		std::tuple{rareMineralImageRect, ResourceNamesRefined[3], mPlayerResources->resources[3], mPreviousResources.resources[3]},
+		std::tuple{commonMetalImageRect, std::size_t{0}},
+		std::tuple{rareMetalImageRect, std::size_t{2}},
+		std::tuple{commonMineralImageRect, std::size_t{1}},
+		std::tuple{rareMineralImageRect, std::size_t{3}},
 	};
 
 	auto position = mRect.startPoint() + NAS2D::Vector{5, 5};
-	for (const auto& [imageRect, text, value, oldValue] : resources)
+	for (const auto& [imageRect, index] : resources)
 	{
-		renderer.drawSubImage(mIcons, position, imageRect);
-		renderer.drawText(mFont, text, position + NAS2D::Vector{23, 0}, NAS2D::Color::White);
-		const auto valueString = std::to_string(value);
-		renderer.drawText(mFont, valueString, position + NAS2D::Vector{195 - mFont.width(valueString), 0}, NAS2D::Color::White);
+		const auto value = mTextResources.resources[index];
+		const auto oldValue = mTextPreviousResources.resources[index];
+
+		drawSubImage(renderer, mIcons, position, imageRect);
+		renderer.drawText(mFont, ResourceNamesRefined[index], position + NAS2D::Vector{23, 0}, NAS2D::Color::White);
+		renderer.drawText(mFont, mValueText[index], position + NAS2D::Vector{195 - mValueWidth[index], 0}, NAS2D::Color::White);
 		const auto& [textColor, iconStartPoint] = trend[trendIndex(value, oldValue)];
 		const auto changeIconImageRect = NAS2D::Rectangle<int>::Create(iconStartPoint, NAS2D::Vector{8, 8});
-		renderer.drawSubImage(mIcons, position + NAS2D::Vector{215, 3}, changeIconImageRect);
-		renderer.drawText(mFont, formatDiff(value - oldValue), position + NAS2D::Vector{235, 0}, textColor);
+		drawSubImage(renderer, mIcons, position + NAS2D::Vector{215, 3}, changeIconImageRect);
+		renderer.drawText(mFont, mDiffText[index], position + NAS2D::Vector{235, 0}, textColor);
 		position.y += 18;
 	}
 }
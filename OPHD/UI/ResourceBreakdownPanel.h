@@ -2,11 +2,15 @@
 
 #include "Core/Control.h"
 #include "../StorableResources.h"
+#include "../TextureAtlas.h"
 
 #include <NAS2D/Resource/Font.h>
 #include <NAS2D/Resource/Image.h>
 #include <NAS2D/Renderer/RectangleSkin.h>
 
+#include <array>
+#include <string>
+
 
 class ResourceBreakdownPanel : public Control
 {
@@ -19,10 +23,20 @@ public:
 	void update() override;
 
 private:
+	void updateText();
+
 	const NAS2D::Font& mFont;
-	const NAS2D::Image& mIcons;
+	const AtlasImage& mIcons;
 	NAS2D::RectangleSkin mSkin;
 
 	StorableResources mPreviousResources;
 	const StorableResources* mPlayerResources = nullptr;
+
+	// Formatted text for the values in mTextResources and mTextPreviousResources
+	bool mTextValid = false;
+	StorableResources mTextResources;
+	StorableResources mTextPreviousResources;
+	std::array<std::string, 4> mValueText;
+	std::array<int, 4> mValueWidth{};
+	std::array<std::string, 4> mDiffText;
 };
@@ -1,5 +1,7 @@
 #include "StringTable.h"
 
+#include "TextLayoutCache.h"
+
 #include "../Cache.h"
 #include "../Constants/UiConstants.h"
 
@@ -170,19 +172,45 @@ void StringTable::computeRelativeCellPositions()
 	}
 }
 
+bool StringTable::hasSameContent(const StringTable& other) const
+{
+	if (mColumnCount != other.mColumnCount || mRowCount != other.mRowCount ||
+		mDefaultFont != other.mDefaultFont || mDefaultTitleFont != other.mDefaultTitleFont ||
+		mDefaultTextColor != other.mDefaultTextColor ||
+		mHorizontalPadding != other.mHorizontalPadding || mVerticalPadding != other.mVerticalPadding)
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0; i < mCells.size(); ++i)
+	{
+		const auto& cell = mCells[i];
+		const auto& otherCell = other.mCells[i];
+
+		if (cell.text != otherCell.text || cell.font != otherCell.font ||
+			cell.justification != otherCell.justification || cell.textColor != otherCell.textColor)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void StringTable::accountForCellJustification(std::size_t index, int columnWidth)
 {
 	auto& cell = mCells[index];
+	auto& textLayoutCache = NAS2D::Utility<TextLayoutCache>::get();
 
 	switch (cell.justification)
 	{
 	case (Justification::Left):
 		return; // No modification required for left justifited
 	case (Justification::Right):
-		cell.textOffset.x += columnWidth - getCellFont(index)->width(cell.text);
+		cell.textOffset.x += columnWidth - textLayoutCache.width(*getCellFont(index), cell.text);
 		return;
 	case (Justification::Center):
-		cell.textOffset.x += (columnWidth - getCellFont(index)->width(cell.text)) / 2;
+		cell.textOffset.x += (columnWidth - textLayoutCache.width(*getCellFont(index), cell.text)) / 2;
 		return;
 	default:
 		return;
@@ -192,6 +220,7 @@ void StringTable::accountForCellJustification(std::size_t index, int columnWidth
 std::vector<int> StringTable::computeColumnWidths() const
 {
 	std::vector<int> columnWidths;
+	auto& textLayoutCache = NAS2D::Utility<TextLayoutCache>::get();
 
 	for (std::size_t column = 0; column < mColumnCount; ++column)
 	{
@@ -200,7 +229,7 @@ std::vector<int> StringTable::computeColumnWidths() const
 		for (std::size_t row = 0; row < mRowCount; ++row)
 		{
 			auto index = getCellIndex(CellCoordinate{column, row});
-			columnWidth = std::max(columnWidth, getCellFont(index)->width(mCells[index].text));
+			columnWidth = std::max(columnWidth, textLayoutCache.width(*getCellFont(index), mCells[index].text));
 		}
 
 		columnWidths.push_back(columnWidth);
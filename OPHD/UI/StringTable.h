@@ -69,6 +69,9 @@ public:
 	// Call after updating table properties to recompute cell positions
 	void computeRelativeCellPositions();
 
+	// True if both tables have the same cells and layout properties, ignoring position
+	bool hasSameContent(const StringTable& other) const;
+
 private:
 	// Purposely hide textOffset from public access
 	struct CellWithPosition : Cell
@@ -78,8 +81,8 @@ private:
 	};
 
 	std::vector<CellWithPosition> mCells;
-	const std::size_t mColumnCount;
-	const std::size_t mRowCount;
+	std::size_t mColumnCount;
+	std::size_t mRowCount;
 	NAS2D::Rectangle<int> mScreenRect;
 	const NAS2D::Font* mDefaultFont;
 	const NAS2D::Font* mDefaultTitleFont;
@@ -2,6 +2,7 @@
 
 #include "../Cache.h"
 #include "../Constants.h"
+#include "../StructureManager.h"
 #include "../Things/Structures/Structure.h"
 #include "StringTable.h"
 #include "TextRender.h"
@@ -9,15 +10,36 @@
 #include <NAS2D/Utility.h>
 
 #include <stdexcept>
+#include <utility>
 
 
 using namespace NAS2D;
 
 
+namespace
+{
+	/**
+	 * Replaces a laid out table with a freshly built one.
+	 *
+	 * Measuring every cell is the expensive part of a table so the
+	 * layout pass is skipped when the displayed content is unchanged.
+	 */
+	void updateLaidOutTable(StringTable& laidOutTable, StringTable&& table)
+	{
+		if (table.hasSameContent(laidOutTable)) { return; }
+
+		table.computeRelativeCellPositions();
+		laidOutTable = std::move(table);
+	}
+}
+
+
 StructureInspector::StructureInspector() :
 	Window{constants::WindowStructureInspector},
 	btnClose{"Close", {this, &StructureInspector::onClose}},
-	mIcons{imageCache.load("ui/icons.png")}
+	mIcons{uiAtlas.image("ui/icons.png")},
+	mStringTable{0, 0},
+	mSpecificTable{0, 0}
 {
 	size({ 350, 240 });
 
@@ -32,9 +54,9 @@ void StructureInspector::structure(Structure* structure)
 
 	if (!mStructure) { return; }
 
-	auto stringTable = buildStringTable();
+	updateTables();
 
-	auto windowWidth = stringTable.screenRect().width + 10;
+	auto windowWidth = mStringTable.screenRect().width + 10;
 	size({ windowWidth < 350 ? 350 : windowWidth, rect().height });
 
 	btnClose.position({ positionX() + rect().width - 55, btnClose.positionY() });
@@ -50,7 +72,6 @@ void StructureInspector::onClose()
 StringTable StructureInspector::buildStringTable() const
 {
 	StringTable stringTable(4, 6);
-	stringTable.position(mRect.startPoint() + NAS2D::Vector{ 5, 25 });
 	stringTable.setVerticalPadding(5);
 	stringTable.setColumnFont(2, stringTable.GetDefaultTitleFont());
 
@@ -108,8 +129,6 @@ StringTable StructureInspector::buildStringTable() const
 		stringTable[{1, 5}].text = std::to_string(mStructure->crimeRate()) + "%";
 	}
 
-	stringTable.computeRelativeCellPositions();
-
 	return stringTable;
 }
 
@@ -127,18 +146,21 @@ void StructureInspector::update()
 	}
 	title(mStructure->name());
 
-	auto stringTable = buildStringTable();
-	stringTable.draw(renderer);
+	// Structures only change during a turn or when the player changes them, both of which are reported by the StructureManager
+	if (mStructureChangeCount != Utility<StructureManager>::get().changeCount()) { updateTables(); }
+
+	mStringTable.position(mRect.startPoint() + NAS2D::Vector{ 5, 25 });
+	mStringTable.draw(renderer);
 
-	drawStructureSpecificTable({ stringTable.position().x, stringTable.screenRect().endPoint().y + 25 }, renderer);
+	mSpecificTable.position({ mStringTable.position().x, mStringTable.screenRect().endPoint().y + 25 });
+	mSpecificTable.draw(renderer);
 }
 
-void StructureInspector::drawStructureSpecificTable(NAS2D::Point<int> position, NAS2D::Renderer& renderer)
+void StructureInspector::updateTables()
 {
-	StringTable stringTable = mStructure->createInspectorViewTable();
-	stringTable.computeRelativeCellPositions();
-	stringTable.position(position);
-	stringTable.draw(renderer);
+	mStructureChangeCount = Utility<StructureManager>::get().changeCount();
+	updateLaidOutTable(mStringTable, buildStringTable());
+	updateLaidOutTable(mSpecificTable, mStructure->createInspectorViewTable());
 }
 
 std::string StructureInspector::getDisabledReason() const
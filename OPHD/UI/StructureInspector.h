@@ -5,6 +5,8 @@
 
 #include "StringTable.h"
 
+#include "../TextureAtlas.h"
+
 #include <NAS2D/Renderer/Renderer.h>
 #include <NAS2D/Renderer/Point.h>
 
@@ -25,12 +27,16 @@ public:
 private:
 	void onClose();
 	std::string getDisabledReason() const;
-	void drawStructureSpecificTable(NAS2D::Point<int> position, NAS2D::Renderer& renderer);
+	void updateTables();
 	std::string formatAge() const;
 
 	StringTable buildStringTable() const;
 
 	Button btnClose;
-	const NAS2D::Image& mIcons;
+	const AtlasImage& mIcons;
 	Structure* mStructure = nullptr;
+
+	StringTable mStringTable; /**< Laid out general table, only replaced when its content changes. */
+	StringTable mSpecificTable; /**< Laid out structure specific table, only replaced when its content changes. */
+	unsigned int mStructureChangeCount = 0; /**< StructureManager change count the tables were built at. */
 };
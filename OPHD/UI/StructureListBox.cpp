@@ -8,6 +8,8 @@
 #include <NAS2D/Utility.h>
 #include <NAS2D/Renderer/Renderer.h>
 
+#include <unordered_set>
+
 
 using namespace NAS2D;
 
@@ -36,11 +38,9 @@ static void drawItem(Renderer& renderer, StructureListBox::StructureListBoxItem&
 }
 
 
-StructureListBox::StructureListBoxItem::StructureListBoxItem(Structure* s) :
-	ListBoxItem{s->name()},
+StructureListBox::StructureListBoxItem::StructureListBoxItem(Structure* s, std::size_t itemNumber) :
 	structure{s},
-	structureState{""},
-	colorIndex{s->state()}
+	number{itemNumber}
 {}
 
 
@@ -59,17 +59,54 @@ StructureListBox::StructureListBox()
  */
 void StructureListBox::addItem(Structure* structure)
 {
-	/// \fixme	Could be much more elegant via a lambda expression
-	for (auto item : mItems)
+	if (mItemIndex.count(structure) > 0)
 	{
-		if (static_cast<StructureListBoxItem*>(item)->structure == structure)
-		{
-			std::cout << "StructureListBox::addItem(): annoying bug, fix it." << std::endl;
-			return;
-		}
+		std::cout << "StructureListBox::addItem(): annoying bug, fix it." << std::endl;
+		return;
 	}
 
-	add<StructureListBoxItem>(structure);
+	mItemIndex[structure] = &add<StructureListBoxItem>(structure, mNextNumber++);
+}
+
+
+/**
+ * Removes a Structure from the StructureListBox.
+ *
+ * \param	structure	Only used to find its item, never dereferenced.
+ */
+void StructureListBox::removeItem(Structure* structure)
+{
+	const auto it = mItemIndex.find(structure);
+	if (it == mItemIndex.end()) { return; }
+
+	remove(*it->second);
+	mItemIndex.erase(it);
+}
+
+
+/**
+ * Shows only the structures \c structureFilter returns true for. Every
+ * structure is shown if it's empty.
+ */
+void StructureListBox::filter(const Filter& structureFilter)
+{
+	if (!structureFilter)
+	{
+		ListBoxBase::filter({});
+		return;
+	}
+
+	ListBoxBase::filter([structureFilter](const ListBoxItem& item) {
+		return structureFilter(*static_cast<const StructureListBoxItem&>(item).structure);
+	});
+}
+
+
+void StructureListBox::clear()
+{
+	ListBoxBase::clear();
+	mItemIndex.clear();
+	mNextNumber = 1;
 }
 
 
@@ -80,32 +117,60 @@ void StructureListBox::addItem(Structure* structure)
  */
 void StructureListBox::setSelected(Structure* structure)
 {
-	if (mItems.empty() || structure == nullptr) { return; }
+	if (isEmpty() || structure == nullptr) { return; }
 
-	for (std::size_t i = 0; i < mItems.size(); ++i)
-	{
-		StructureListBoxItem* item = static_cast<StructureListBoxItem*>(mItems[i]);
-		if (item->structure == structure)
-		{
-			setSelection(i);
-			return;
-		}
-	}
+	const auto it = mItemIndex.find(structure);
+	if (it != mItemIndex.end()) { setSelection(rowIndex(*it->second)); }
 }
 
 
 Structure* StructureListBox::selectedStructure()
 {
-	return (selectedIndex() == constants::NoSelection) ? nullptr : static_cast<StructureListBoxItem*>(mItems[selectedIndex()])->structure;
+	return (selectedIndex() == constants::NoSelection) ? nullptr : static_cast<StructureListBoxItem*>(mRows[selectedIndex()])->structure;
 }
 
 
 /**
- * Convenience function to get the last item in the list.
+ * Text of the selected row, formatted on demand.
+ *
+ * \return	Returns an empty string if nothing is selected.
  */
-StructureListBox::StructureListBoxItem* StructureListBox::last()
+const std::string& StructureListBox::selectedText()
 {
-	return static_cast<StructureListBoxItem*>(mItems.back());
+	static const std::string noText;
+	if (selectedIndex() == constants::NoSelection) { return noText; }
+
+	auto& item = *static_cast<StructureListBoxItem*>(mRows[selectedIndex()]);
+	format(item);
+	return item.text;
+}
+
+
+/**
+ * Removes the items for structures not in \c structures and marks the
+ * rest to be formatted again.
+ */
+void StructureListBox::syncRemoved(const std::vector<Structure*>& structures)
+{
+	const std::unordered_set<Structure*> listed(structures.begin(), structures.end());
+
+	std::vector<Structure*> removed;
+	for (const auto& [structure, item] : mItemIndex)
+	{
+		if (listed.count(structure) == 0) { removed.push_back(structure); }
+		else { item->formatted = false; }
+	}
+	for (auto structure : removed) { removeItem(structure); }
+}
+
+
+void StructureListBox::format(StructureListBoxItem& item) const
+{
+	if (item.formatted) { return; }
+
+	item.text = mNumbered ? item.structure->name() + " #" + std::to_string(item.number) : item.structure->name();
+	item.structureState = mStateText ? mStateText(*item.structure) : std::string{};
+	item.formatted = true;
 }
 
 
@@ -122,9 +187,12 @@ void StructureListBox::update()
 	renderer.clipRect(mRect);
 
 	// ITEMS
-	for (std::size_t i = 0; i < mItems.size(); ++i)
+	const auto [firstVisible, endVisible] = visibleItemRange();
+	for (std::size_t i = firstVisible; i < endVisible; ++i)
 	{
-		drawItem(renderer, *static_cast<StructureListBoxItem*>(mItems[i]),
+		auto& item = *static_cast<StructureListBoxItem*>(mRows[i]);
+		format(item);
+		drawItem(renderer, item,
 			positionX(),
 			positionY() + (static_cast<int>(i) * LIST_ITEM_HEIGHT),
 			static_cast<int>(item_width()),
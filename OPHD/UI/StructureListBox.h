@@ -6,6 +6,11 @@
 
 #include <NAS2D/Signal/Signal.h>
 
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 
 class Structure;
 
@@ -17,25 +22,68 @@ class StructureListBox : public ListBoxBase
 {
 public:
 	using SelectionChangedSignal = NAS2D::Signal<Structure*>;
+	using Filter = std::function<bool(const Structure&)>;
+	using StateText = std::function<std::string(const Structure&)>;
 
+	/**
+	 * Row for a Structure. Its text is only formatted once the row is
+	 * drawn or asked for.
+	 */
 	struct StructureListBoxItem : public ListBoxItem
 	{
-		StructureListBoxItem(Structure* s);
+		StructureListBoxItem(Structure* s, std::size_t itemNumber);
 
 		Structure* structure = nullptr; /**< Pointer to a Structure. */
+		std::size_t number = 0; /**< Shown after the name if the list is numbered. */
 		std::string structureState; /**< String description of the state of a Structure. */
-		StructureState colorIndex; /**< Index to use from the listbox color table. */
+		bool formatted = false; /**< \c text and \c structureState are up to date. */
 	};
 
 
 	StructureListBox();
 
+	void numbered(bool isNumbered) { mNumbered = isNumbered; }
+	void stateText(StateText stateTextFunction) { mStateText = std::move(stateTextFunction); }
+
 	void addItem(Structure*);
+	void removeItem(Structure*);
+	template <typename StructureType>
+	void sync(const std::vector<StructureType*>& structures);
+	void filter(const Filter& structureFilter);
 	void setSelected(Structure*);
 
-	Structure* selectedStructure();
+	void clear() override;
 
-	StructureListBoxItem* last();
+	Structure* selectedStructure();
+	const std::string& selectedText();
 
 	void update() override;
+
+private:
+	void syncRemoved(const std::vector<Structure*>& structures);
+	void format(StructureListBoxItem& item) const;
+
+	std::unordered_map<Structure*, StructureListBoxItem*> mItemIndex; /**< Item of each listed Structure. */
+	std::size_t mNextNumber = 1;
+	bool mNumbered = false; /**< Names are followed by a number to tell structures of the same type apart. */
+	StateText mStateText; /**< Formats the text shown on the right of a row. Nothing is shown if empty. */
 };
+
+
+/**
+ * Adds and removes items so the list holds exactly \c structures.
+ *
+ * Items for structures already listed are kept, new structures are
+ * added at the end. Every item's text is formatted again the next time
+ * it's drawn.
+ */
+template <typename StructureType>
+void StructureListBox::sync(const std::vector<StructureType*>& structures)
+{
+	syncRemoved({structures.begin(), structures.end()});
+
+	for (auto structure : structures)
+	{
+		if (mItemIndex.count(structure) == 0) { addItem(structure); }
+	}
+}
@@ -0,0 +1,70 @@
+#include "TextLayoutCache.h"
+
+#include <functional>
+#include <utility>
+
+
+namespace
+{
+	// Bounds memory use when text keeps changing, e.g. counters that
+	// tick every turn. Entries are cheap to measure again.
+	const std::size_t MaxCachedExtents = 4096;
+}
+
+
+int TextLayoutCache::width(const NAS2D::Font& font, const std::string& text)
+{
+	Key key{&font, text};
+
+	const auto it = mWidths.find(key);
+	if (it != mWidths.end()) { return it->second; }
+
+	if (mWidths.size() >= MaxCachedExtents) { mWidths.clear(); }
+
+	const auto textWidth = font.width(text);
+	mWidths.emplace(std::move(key), textWidth);
+	return textWidth;
+}
+
+
+void TextLayoutCache::clear()
+{
+	mWidths.clear();
+}
+
+
+std::size_t TextLayoutCache::KeyHash::operator()(const Key& key) const
+{
+	const auto fontHash = std::hash<const NAS2D::Font*>{}(key.font);
+	const auto textHash = std::hash<std::string>{}(key.text);
+	return textHash ^ (fontHash + 0x9e3779b9 + (textHash << 6) + (textHash >> 2));
+}
+
+
+const std::string& ValueText::format(int value)
+{
+	if (!mValid || mHasTotal || value != mValue)
+	{
+		mText = std::to_string(value);
+		mValue = value;
+		mHasTotal = false;
+		mValid = true;
+	}
+
+	return mText;
+}
+
+
+const std::string& ValueText::format(int value, int total)
+{
+	if (!mValid || !mHasTotal || value != mValue || total != mTotal)
+	{
+		mText = std::to_string(value) + "/" + std::to_string(total);
+		mValue = value;
+		mTotal = total;
+		mHasTotal = true;
+		mValid = true;
+	}
+
+	return mText;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <NAS2D/Resource/Font.h>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+
+/**
+ * Caches measured text extents by font and string.
+ *
+ * UI text is mostly the same handful of labels and numbers from one
+ * frame to the next so measuring each once is enough.
+ *
+ * \note	NAS2D lays out glyphs inside Renderer::drawText and doesn't
+ *			expose shaped glyph runs, so only extents are cached.
+ */
+class TextLayoutCache
+{
+public:
+	int width(const NAS2D::Font& font, const std::string& text);
+
+	std::size_t size() const { return mWidths.size(); }
+	void clear();
+
+private:
+	struct Key
+	{
+		const NAS2D::Font* font;
+		std::string text;
+
+		bool operator==(const Key& other) const { return font == other.font && text == other.text; }
+	};
+
+	struct KeyHash
+	{
+		std::size_t operator()(const Key& key) const;
+	};
+
+	std::unordered_map<Key, int, KeyHash> mWidths;
+};
+
+
+/**
+ * Text for one or two integer values that is only reformatted when a
+ * value changes.
+ */
+class ValueText
+{
+public:
+	const std::string& format(int value);
+	const std::string& format(int value, int total);
+
+private:
+	std::string mText;
+	int mValue = 0;
+	int mTotal = 0;
+	bool mHasTotal = false;
+	bool mValid = false;
+};
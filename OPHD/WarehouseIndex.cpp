@@ -0,0 +1,214 @@
+#include "WarehouseIndex.h"
+
+#include "ProductPool.h"
+#include "Things/Structures/Warehouse.h"
+
+#include <algorithm>
+#include <utility>
+
+
+namespace
+{
+	const int EmptySlot = -1; /**< Free storage of a slot without a warehouse so it never matches. */
+}
+
+
+/**
+ * Adds a warehouse to the index and links its ProductPool so changes to
+ * its storage keep the index current.
+ */
+void WarehouseIndex::add(Warehouse* warehouse)
+{
+	std::size_t slot = mWarehouses.size();
+	if (mFreeSlots.empty())
+	{
+		if (slot == mLeafCount) { grow(); }
+		mWarehouses.push_back(warehouse);
+	}
+	else
+	{
+		slot = mFreeSlots.back();
+		mFreeSlots.pop_back();
+		mWarehouses[slot] = warehouse;
+	}
+
+	warehouse->products().index(this, slot);
+	update(slot, warehouse->products().availableStorage());
+}
+
+
+/**
+ * Removes a warehouse from the index. Its slot is read from its ProductPool
+ * so no search is needed.
+ */
+void WarehouseIndex::remove(Warehouse* warehouse)
+{
+	auto& products = warehouse->products();
+	if (products.index() != this) { return; }
+
+	const auto slot = products.indexSlot();
+	products.index(nullptr, 0);
+	mWarehouses[slot] = nullptr;
+	mFreeSlots.push_back(slot);
+	update(slot, EmptySlot);
+}
+
+
+void WarehouseIndex::clear()
+{
+	for (auto warehouse : mWarehouses)
+	{
+		if (warehouse) { warehouse->products().index(nullptr, 0); }
+	}
+
+	mWarehouses.clear();
+	mFreeSlots.clear();
+	mTree.clear();
+	mLeafCount = 0;
+}
+
+
+/**
+ * Finds the first slot under node with at least storageNeeded free storage
+ * whose warehouse passes predicate. Subtrees without enough room anywhere
+ * are skipped.
+ */
+template <typename Predicate>
+std::size_t WarehouseIndex::findSlot(std::size_t node, std::size_t nodeBegin, std::size_t nodeEnd, int storageNeeded, Predicate predicate) const
+{
+	if (mTree[node] < std::max(storageNeeded, 0)) { return NotFound; }
+
+	if (nodeEnd - nodeBegin == 1)
+	{
+		return predicate(*mWarehouses[nodeBegin]) ? nodeBegin : NotFound;
+	}
+
+	const auto middle = nodeBegin + (nodeEnd - nodeBegin) / 2;
+	const auto slot = findSlot(2 * node, nodeBegin, middle, storageNeeded, predicate);
+	return slot != NotFound ? slot : findSlot(2 * node + 1, middle, nodeEnd, storageNeeded, predicate);
+}
+
+
+/**
+ * Gets a warehouse with at least storageNeeded free storage whether or not
+ * it's operational.
+ *
+ * \return	Returns nullptr if no warehouse has enough room.
+ */
+Warehouse* WarehouseIndex::findStorage(int storageNeeded) const
+{
+	if (mLeafCount == 0) { return nullptr; }
+
+	const auto slot = findSlot(1, 0, mLeafCount, storageNeeded, [](const Warehouse&) { return true; });
+	return slot == NotFound ? nullptr : mWarehouses[slot];
+}
+
+
+/**
+ * Gets an operational warehouse with at least storageNeeded free storage.
+ *
+ * \return	Returns nullptr if no operational warehouse has enough room.
+ */
+Warehouse* WarehouseIndex::findOperationalStorage(int storageNeeded) const
+{
+	if (mLeafCount == 0) { return nullptr; }
+
+	const auto slot = findSlot(1, 0, mLeafCount, storageNeeded, [](const Warehouse& warehouse) { return warehouse.operational(); });
+	return slot == NotFound ? nullptr : mWarehouses[slot];
+}
+
+
+/**
+ * Plans moving all of the products out of a warehouse and into other
+ * operational warehouses.
+ *
+ * Warehouses with room are gathered from the index once and filled in slot
+ * order. Nothing is moved, apply the plan by storing each Transfer in its
+ * destination and pulling it from the source.
+ *
+ * \return	True if every product has somewhere to go.
+ */
+bool WarehouseIndex::planTransferFrom(Warehouse& source, TransferPlan& plan) const
+{
+	plan.clear();
+
+	struct Destination
+	{
+		Warehouse* warehouse;
+		int availableStorage;
+	};
+
+	std::vector<Destination> destinations;
+	for (std::size_t slot = 0; slot < mWarehouses.size(); ++slot)
+	{
+		const auto availableStorage = mTree[mLeafCount + slot];
+		auto warehouse = mWarehouses[slot];
+		if (availableStorage <= 0 || warehouse == &source || !warehouse->operational()) { continue; }
+		destinations.push_back({warehouse, availableStorage});
+	}
+
+	auto& products = source.products();
+	bool allPlaced = true;
+
+	for (std::size_t i = 0; i < ProductType::PRODUCT_COUNT; ++i)
+	{
+		const auto productType = static_cast<ProductType>(i);
+		const auto unitStorage = storageRequiredPerUnit(productType);
+		auto remaining = products.count(productType);
+
+		for (auto& destination : destinations)
+		{
+			if (remaining == 0) { break; }
+
+			const auto units = unitStorage == 0 ? remaining : std::min(remaining, destination.availableStorage / unitStorage);
+			if (units == 0) { continue; }
+
+			plan.push_back({destination.warehouse, productType, units});
+			destination.availableStorage -= units * unitStorage;
+			remaining -= units;
+		}
+
+		allPlaced = allPlaced && remaining == 0;
+	}
+
+	return allPlaced;
+}
+
+
+/**
+ * Sets the free storage of a slot. Called by ProductPool whenever its
+ * contents change.
+ */
+void WarehouseIndex::update(std::size_t slot, int availableStorage)
+{
+	auto node = mLeafCount + slot;
+	mTree[node] = availableStorage;
+
+	for (node /= 2; node > 0; node /= 2)
+	{
+		mTree[node] = std::max(mTree[2 * node], mTree[2 * node + 1]);
+	}
+}
+
+
+/**
+ * Doubles the number of leaves and rebuilds the tree above them.
+ */
+void WarehouseIndex::grow()
+{
+	const auto oldLeafCount = mLeafCount;
+	mLeafCount = std::max<std::size_t>(mLeafCount * 2, 8);
+
+	std::vector<int> tree(2 * mLeafCount, EmptySlot);
+	for (std::size_t slot = 0; slot < oldLeafCount; ++slot)
+	{
+		tree[mLeafCount + slot] = mTree[oldLeafCount + slot];
+	}
+
+	for (auto node = mLeafCount - 1; node > 0; --node)
+	{
+		tree[node] = std::max(tree[2 * node], tree[2 * node + 1]);
+	}
+
+	mTree = std::move(tree);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Common.h"
+
+#include <cstddef>
+#include <vector>
+
+
+class Warehouse;
+
+
+/**
+ * Tracks the free product storage of every warehouse so one with room can
+ * be found without checking them all.
+ *
+ * Free storage is kept in a max segment tree over warehouse slots. Each
+ * warehouse's ProductPool reports changes to the index as products are
+ * stored and pulled, so finding a warehouse with enough room takes
+ * O(log W).
+ *
+ * \note	Whether a warehouse is operational isn't tracked. It's checked
+ *			when a warehouse is found and warehouses that aren't are skipped.
+ */
+class WarehouseIndex
+{
+public:
+	/** Products planned to be moved into a warehouse. */
+	struct Transfer
+	{
+		Warehouse* destination;
+		ProductType type;
+		int count;
+	};
+
+	using TransferPlan = std::vector<Transfer>;
+
+	void add(Warehouse* warehouse);
+	void remove(Warehouse* warehouse);
+	void clear();
+
+	Warehouse* findStorage(int storageNeeded) const;
+	Warehouse* findOperationalStorage(int storageNeeded) const;
+
+	bool planTransferFrom(Warehouse& source, TransferPlan& plan) const;
+
+	void update(std::size_t slot, int availableStorage);
+
+private:
+	static constexpr std::size_t NotFound = static_cast<std::size_t>(-1);
+
+	template <typename Predicate>
+	std::size_t findSlot(std::size_t node, std::size_t nodeBegin, std::size_t nodeEnd, int storageNeeded, Predicate predicate) const;
+
+	void grow();
+
+	std::vector<Warehouse*> mWarehouses; /**< Warehouse in each slot, nullptr for a free slot. */
+	std::vector<std::size_t> mFreeSlots;
+	std::vector<int> mTree; /**< Max free storage under each node. Node 1 is the root, leaves start at mLeafCount. */
+	std::size_t mLeafCount = 0;
+};
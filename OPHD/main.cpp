@@ -1,6 +1,8 @@
 #include "Cache.h"
 #include "Common.h"
 #include "Constants.h"
+#include "FrameScheduler.h"
+#include "StartupTimer.h"
 #include "WindowEventWrapper.h"
 
 #include "States/GameState.h"
@@ -8,6 +10,7 @@
 #include "States/MainMenuState.h"
 #include "States/MapViewState.h"
 #include "States/MainReportsUiState.h"
+#include "States/Planet.h"
 
 #include <NAS2D/Utility.h>
 #include <NAS2D/Filesystem.h>
@@ -42,6 +45,7 @@ int main(int argc, char *argv[])
 
 	try
 	{
+		StartupTimer::Stage stage{"Filesystem"};
 		auto& filesystem = Utility<Filesystem>::init<Filesystem>(argv[0], "OutpostHD", "LairWorks");
 		// Prioritize data from working directory, fallback on data from executable path
 		filesystem.mountSoftFail("data");
@@ -50,6 +54,14 @@ int main(int argc, char *argv[])
 
 		filesystem.makeDirectory(constants::SaveGamePath);
 
+		// Planet definitions, UI sheets and sprite files don't need the renderer
+		// so read them on workers while the mixer and renderer come up and the
+		// splash screen is shown.
+		preloadPlanetAttributes();
+		decodedImageCache.preload(UiAtlasImages);
+		spriteCache.preload({"structures/", "robots/"});
+
+		stage.next("Configuration");
 		Configuration& cf = Utility<Configuration>::init(
 			std::map<std::string, Dictionary>{
 				{
@@ -77,7 +89,8 @@ int main(int argc, char *argv[])
 					"options",
 					{{
 						{"skip-splash", false},
-						{"maximized", true}
+						{"maximized", true},
+						{"power-saving", false}
 					}}
 				}
 			}
@@ -91,6 +104,7 @@ int main(int argc, char *argv[])
 		// Force windowed mode
 		graphics.set("fullscreen", false);
 
+		stage.next("Mixer");
 		try
 		{
 			Utility<Mixer>::init<MixerSDL>();
@@ -102,6 +116,7 @@ int main(int argc, char *argv[])
 
 		WindowEventWrapper windowEventWrapper;
 
+		stage.next("Renderer");
 		auto& renderer = Utility<Renderer>::init<RendererOpenGL>("OutpostHD");
 
 		std::cout << std::endl << "** GAME START **" << std::endl << std::endl;
@@ -120,9 +135,15 @@ int main(int argc, char *argv[])
 			SDL_MaximizeWindow(underlyingWindow);
 		}
 
+		stage.next("Texture atlas");
+		uiAtlas.build(UiAtlasImages);
+		decodedImageCache.clear();
+
+		stage.next("Music");
 		trackMars = std::make_unique<NAS2D::Music>("music/mars.ogg");
 		Utility<Mixer>::get().playMusic(*trackMars);
 
+		stage.next("Initial state");
 		StateManager stateManager;
 		stateManager.forceStopAudio(false);
 
@@ -154,10 +175,19 @@ int main(int argc, char *argv[])
 			stateManager.setState(new MainMenuState());
 		}
 
+		stage.end();
+		Utility<StartupTimer>::get().report(std::cout);
+
+		// Power saving lets idle states sleep between frames instead
+		// of redrawing at full rate.
+		auto& frameScheduler = Utility<FrameScheduler>::get();
+		frameScheduler.enabled(options.get<bool>("power-saving"));
+
 		// Game Loop
 		while (stateManager.update())
 		{
 			Utility<Renderer>::get().update();
+			frameScheduler.waitForNextFrame();
 		}
 
 		cf.save("config.xml"); // force configuration to save any changes.
@@ -167,6 +197,9 @@ int main(int argc, char *argv[])
 		doNonFatalErrorMessage("Application Error", e.what());
 	}
 
+	spriteCache.clear();
+	decodedImageCache.clear();
+	uiAtlas.clear();
 	imageCache.clear();
 
 	#ifdef NDEBUG
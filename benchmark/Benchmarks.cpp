@@ -0,0 +1,428 @@
+#include "Benchmarks.h"
+
+#include "RecordingRenderer.h"
+
+#include "../OPHD/Common.h"
+#include "../OPHD/Constants.h"
+#include "../OPHD/StorableResources.h"
+#include "../OPHD/StructureCatalogue.h"
+#include "../OPHD/StructureManager.h"
+#include "../OPHD/States/GameState.h"
+#include "../OPHD/States/MainReportsUiState.h"
+#include "../OPHD/States/MapViewState.h"
+
+#include <NAS2D/Utility.h>
+#include <NAS2D/Filesystem.h>
+#include <NAS2D/ParserHelper.h>
+#include <NAS2D/Renderer/RendererOpenGL.h>
+#include <NAS2D/StateManager.h>
+#include <NAS2D/Resource/Image.h>
+#include <NAS2D/Xml/XmlDocument.h>
+#include <NAS2D/Xml/XmlMemoryBuffer.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+
+extern const std::string MAP_TERRAIN_EXTENSION;
+
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+	using TilePosition = std::tuple<int, int, int>;
+
+	// Matches the transfer limit in MapViewState::transportResourcesToStorage()
+	const int TransferLimit = 25;
+
+
+	/**
+	 * StorableResources as it was before it was given an SSE2 lane, with a
+	 * loop over the counts for every operation.
+	 */
+	struct ScalarResources
+	{
+		ScalarResources& operator+=(const ScalarResources& other)
+		{
+			for (std::size_t i = 0; i < resources.size(); ++i)
+			{
+				resources[i] += other.resources[i];
+			}
+
+			return *this;
+		}
+
+		ScalarResources& operator-=(const ScalarResources& other)
+		{
+			for (std::size_t i = 0; i < resources.size(); ++i)
+			{
+				resources[i] -= other.resources[i];
+			}
+
+			return *this;
+		}
+
+		bool operator<=(const ScalarResources& other) const
+		{
+			for (std::size_t i = 0; i < resources.size(); ++i)
+			{
+				if (!(resources[i] <= other.resources[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		ScalarResources cap(int max) const
+		{
+			ScalarResources out;
+			for (std::size_t i = 0; i < resources.size(); ++i)
+			{
+				out.resources[i] = std::clamp(resources[i], 0, max);
+			}
+
+			return out;
+		}
+
+		bool isEmpty() const
+		{
+			for (std::size_t i = 0; i < resources.size(); ++i)
+			{
+				if (resources[i] > 0)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		std::array<int, 4> resources{};
+	};
+
+
+	template <typename Resources>
+	std::vector<Resources> randomResources(std::size_t count)
+	{
+		// Fixed seed so both types time the same data
+		std::mt19937 generator{12345};
+		std::uniform_int_distribution<int> distribution{-10, 100};
+
+		std::vector<Resources> resources(count);
+		for (auto& entry : resources)
+		{
+			for (auto& amount : entry.resources)
+			{
+				amount = distribution(generator);
+			}
+		}
+
+		return resources;
+	}
+
+
+	/**
+	 * The StorableResources work a turn does for each smelter: cap what
+	 * can be moved, check it against what's stored, move it and put it back.
+	 */
+	template <typename Resources>
+	Resources resourcePass(std::vector<Resources>& stored)
+	{
+		Resources total;
+		for (auto& resources : stored)
+		{
+			const auto moved = resources.cap(TransferLimit);
+			if (moved.isEmpty() || !(moved <= resources)) { continue; }
+
+			resources -= moved;
+			total += moved;
+			resources += moved;
+		}
+
+		return total;
+	}
+
+
+	template <typename Resources>
+	double nanosecondsPerEntry(std::size_t count, int iterations, Resources& checksum)
+	{
+		auto stored = randomResources<Resources>(count);
+
+		const auto start = Clock::now();
+		for (int i = 0; i < iterations; ++i)
+		{
+			checksum += resourcePass(stored);
+		}
+		const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+		return elapsed / (static_cast<double>(count) * iterations);
+	}
+
+
+	template <typename Resources>
+	void print(std::ostream& out, const char* name, double nanoseconds, const Resources& checksum)
+	{
+		out << "  " << name << ": " << nanoseconds << " ns per entry (checksum " <<
+			checksum.resources[0] << " " << checksum.resources[1] << " " <<
+			checksum.resources[2] << " " << checksum.resources[3] << ")" << std::endl;
+	}
+
+
+	// Structures added to synthetic saves. None of them need anything else
+	// from the save to load.
+	const std::vector<StructureID> SyntheticStructureTypes{
+		StructureID::SID_RESIDENCE,
+		StructureID::SID_COMMERCIAL,
+		StructureID::SID_PARK,
+		StructureID::SID_LABORATORY,
+		StructureID::SID_MEDICAL_CENTER,
+		StructureID::SID_RECREATION_CENTER,
+	};
+
+
+	void writeSavegame(NAS2D::Xml::XmlDocument& document, const std::string& filename)
+	{
+		NAS2D::Xml::XmlMemoryBuffer buffer;
+		document.accept(&buffer);
+		NAS2D::Utility<NAS2D::Filesystem>::get().write(filename, buffer.buffer());
+	}
+
+
+	/**
+	 * Tiles already taken by a savegame's structures and robots.
+	 */
+	std::set<TilePosition> occupiedTiles(NAS2D::Xml::XmlElement& root)
+	{
+		std::set<TilePosition> occupied;
+		for (const auto* listName : {"structures", "robots"})
+		{
+			auto* list = root.firstChildElement(listName);
+			if (!list) { continue; }
+
+			for (auto* element = list->firstChildElement(); element; element = element->nextSiblingElement())
+			{
+				const auto dictionary = NAS2D::attributesToDictionary(*element);
+				occupied.insert({dictionary.get<int>("x", 0), dictionary.get<int>("y", 0), dictionary.get<int>("depth", 0)});
+			}
+		}
+
+		return occupied;
+	}
+
+
+	/**
+	 * Writes a copy of a savegame with structureCount more structures on
+	 * free tiles, filling the deepest level first.
+	 *
+	 * \throws	std::runtime_error if the map doesn't have enough free tiles.
+	 */
+	void writeSyntheticSave(const std::string& savegame, const std::string& filename, std::size_t structureCount)
+	{
+		auto document = openSavegame(savegame);
+		auto& root = *document.firstChildElement(constants::SaveGameRootNode);
+
+		const auto properties = NAS2D::attributesToDictionary(*root.firstChildElement("properties"));
+		const auto maxDepth = properties.get<int>("diggingdepth");
+		const auto mapSize = NAS2D::Image{properties.get("sitemap") + MAP_TERRAIN_EXTENSION}.size();
+
+		// Saved the same way StructureManager saves real structures
+		StructureCatalogue::init(properties.get<float>("meansolardistance"));
+		std::vector<NAS2D::Dictionary> templates;
+		for (auto type : SyntheticStructureTypes)
+		{
+			const std::unique_ptr<Structure> structure{StructureCatalogue::get(type)};
+			templates.push_back(structure->getDataDict());
+		}
+
+		const auto occupied = occupiedTiles(root);
+		auto& structures = *root.firstChildElement("structures");
+
+		std::size_t added = 0;
+		for (int depth = maxDepth; depth >= 0 && added < structureCount; --depth)
+		{
+			for (int y = 0; y < mapSize.y && added < structureCount; ++y)
+			{
+				for (int x = 0; x < mapSize.x && added < structureCount; ++x)
+				{
+					if (occupied.count({x, y, depth}) != 0) { continue; }
+
+					auto dictionary = templates[added % templates.size()];
+					dictionary.set("x", x);
+					dictionary.set("y", y);
+					dictionary.set("depth", depth);
+					structures.linkEndChild(NAS2D::dictionaryToAttributes("structure", dictionary));
+					++added;
+				}
+			}
+		}
+
+		if (added < structureCount)
+		{
+			throw std::runtime_error("loadBenchmark(): '" + savegame + "' only has room for " + std::to_string(added) + " more structures.");
+		}
+
+		writeSavegame(document, filename);
+	}
+
+
+	/**
+	 * Writes a copy of a savegame with its colonists replaced by population
+	 * colonists spread evenly over every role.
+	 */
+	void writePopulationSave(const std::string& savegame, const std::string& filename, int population)
+	{
+		auto document = openSavegame(savegame);
+		auto& element = *document.firstChildElement(constants::SaveGameRootNode)->firstChildElement("population");
+
+		const std::array<const char*, 5> roles{"children", "students", "workers", "scientists", "retired"};
+		for (std::size_t i = 0; i < roles.size(); ++i)
+		{
+			// Workers take the remainder
+			const int count = population / 5 + (i == 2 ? population % 5 : 0);
+			element.attribute(roles[i], std::to_string(count));
+		}
+
+		writeSavegame(document, filename);
+	}
+}
+
+
+void drawCallBenchmark(std::ostream& out, const std::vector<std::string>& savegames, int frames)
+{
+	auto& renderer = static_cast<RecordingRenderer<NAS2D::RendererOpenGL>&>(NAS2D::Utility<NAS2D::Renderer>::get());
+
+	DrawCallStats total;
+	for (const auto& savegame : savegames)
+	{
+		// Each savegame gets a state manager of its own so the last game is gone before the next loads
+		NAS2D::StateManager stateManager;
+		stateManager.forceStopAudio(false);
+
+		auto* gameState = new GameState();
+		auto* mapView = new MapViewState(gameState->getMainReportsState(), savegame);
+		mapView->_initialize();
+		mapView->activate();
+		gameState->mapviewstate(mapView);
+		stateManager.setState(gameState);
+
+		renderer.resetStats();
+		for (int frame = 0; frame < frames && stateManager.update(); ++frame)
+		{
+			renderer.update();
+		}
+
+		out << "Draw benchmark '" << savegame << "'" << std::endl << renderer.total() << std::endl;
+		total += renderer.total();
+	}
+
+	if (savegames.size() > 1)
+	{
+		out << "Draw benchmark, all savegames" << std::endl << total << std::endl;
+	}
+}
+
+
+void storableResourcesBenchmark(std::ostream& out, std::size_t count, int iterations)
+{
+	ScalarResources scalarChecksum;
+	const auto scalar = nanosecondsPerEntry(count, iterations, scalarChecksum);
+
+	StorableResources checksum;
+	const auto current = nanosecondsPerEntry(count, iterations, checksum);
+
+	out << "StorableResources benchmark, " << count << " entries x " << iterations << " passes" << std::endl;
+#ifdef OPHD_STORABLE_RESOURCES_SSE2
+	out << "  StorableResources uses SSE2" << std::endl;
+#endif
+	print(out, "Scalar           ", scalar, scalarChecksum);
+	print(out, "StorableResources", current, checksum);
+}
+
+
+void loadBenchmark(std::ostream& out, const std::string& savegame, const std::vector<std::size_t>& structureCounts)
+{
+	auto& filesystem = NAS2D::Utility<NAS2D::Filesystem>::get();
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
+	MainReportsUiState mainReportsState;
+
+	out << "Load benchmark '" << savegame << "'" << std::endl;
+	for (const auto structureCount : structureCounts)
+	{
+		const auto filename = constants::SaveGamePath + "load-benchmark-" + std::to_string(structureCount) + ".xml";
+		writeSyntheticSave(savegame, filename, structureCount);
+
+		double milliseconds = 0.0;
+		int loadedCount = 0;
+		try
+		{
+			// Includes setting up the map view's UI, which doesn't depend on the save
+			const auto start = Clock::now();
+			MapViewState mapView{mainReportsState, filename};
+			mapView._initialize();
+			milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			loadedCount = structureManager.count();
+
+			// Structures have to go before the map view deletes the tiles they're on
+			structureManager.dropAllStructures();
+		}
+		catch (...)
+		{
+			filesystem.del(filename);
+			throw;
+		}
+
+		filesystem.del(filename);
+
+		out << "  " << structureCount << " structures added (" << loadedCount << " loaded): " << milliseconds << " ms" << std::endl;
+	}
+}
+
+
+void turnBenchmark(std::ostream& out, const std::string& savegame, const std::vector<int>& populations, int turns)
+{
+	auto& filesystem = NAS2D::Utility<NAS2D::Filesystem>::get();
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
+	MainReportsUiState mainReportsState;
+
+	out << "Turn benchmark '" << savegame << "', " << turns << " turns" << std::endl;
+	for (const auto population : populations)
+	{
+		const auto filename = constants::SaveGamePath + "turn-benchmark-" + std::to_string(population) + ".xml";
+		writePopulationSave(savegame, filename, population);
+
+		double milliseconds = 0.0;
+		int finalPopulation = 0;
+		try
+		{
+			MapViewState mapView{mainReportsState, filename};
+			mapView._initialize();
+
+			const auto start = Clock::now();
+			for (int turn = 0; turn < turns; ++turn)
+			{
+				mapView.processTurn();
+			}
+			milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / turns;
+			finalPopulation = mapView.populationSize();
+
+			// Structures have to go before the map view deletes the tiles they're on
+			structureManager.dropAllStructures();
+		}
+		catch (...)
+		{
+			filesystem.del(filename);
+			throw;
+		}
+
+		filesystem.del(filename);
+
+		out << "  " << population << " colonists: " << milliseconds << " ms per turn (" << finalPopulation << " colonists after)" << std::endl;
+	}
+}
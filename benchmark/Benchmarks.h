@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/**
+ * Counts the draw calls and times the CPU side of drawing each savegame's
+ * map view for a number of frames.
+ *
+ * \param	savegames	Savegame files to draw, one after another.
+ * \param	frames		Number of frames drawn for each savegame.
+ *
+ * \note	The renderer must be a RecordingRenderer<NAS2D::RendererOpenGL>.
+ */
+void drawCallBenchmark(std::ostream& out, const std::vector<std::string>& savegames, int frames);
+
+
+/**
+ * Times the StorableResources work done for each smelter at the end of a
+ * turn with StorableResources against the same work with the plain scalar
+ * loops it used before it had an SSE2 lane.
+ *
+ * \param	count		Number of StorableResources in each pass.
+ * \param	iterations	Number of passes timed for each version.
+ */
+void storableResourcesBenchmark(std::ostream& out, std::size_t count, int iterations);
+
+
+/**
+ * Times loading copies of a savegame with extra structures added to it.
+ *
+ * For each count a synthetic save holding the savegame's own structures
+ * plus that many more is written next to it, loaded through MapViewState
+ * and deleted again.
+ *
+ * \param	savegame			Savegame file the synthetic saves are based on.
+ * \param	structureCounts		Number of structures added for each save.
+ *
+ * \note	Needs the filesystem and renderer set up since loading a game
+ *			loads the map's images.
+ */
+void loadBenchmark(std::ostream& out, const std::string& savegame, const std::vector<std::size_t>& structureCounts);
+
+
+/**
+ * Times end of turn processing for copies of a savegame with different
+ * numbers of colonists.
+ *
+ * Colonists are spread evenly over every role. The turns are run without
+ * drawing the processing turn screen so only the simulation is timed.
+ *
+ * \param	savegame	Savegame file the synthetic saves are based on.
+ * \param	populations	Number of colonists in each save.
+ * \param	turns		Number of turns timed for each save.
+ *
+ * \note	Needs the filesystem and renderer set up since loading a game
+ *			loads the map's images.
+ */
+void turnBenchmark(std::ostream& out, const std::string& savegame, const std::vector<int>& populations, int turns);
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <NAS2D/Renderer/Renderer.h>
+#include <NAS2D/Resource/Image.h>
+#include <NAS2D/Resource/Font.h>
+
+#include <chrono>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+
+/**
+ * Draw call counts for one or more frames.
+ */
+struct DrawCallStats
+{
+	int frames = 0;
+	int imageDraws = 0;
+	int primitiveDraws = 0;
+	int textDraws = 0;
+	int textureSwitches = 0;
+	int clipChanges = 0;
+	std::chrono::steady_clock::duration cpuTime{0}; /**< Time spent between the start of a frame and the call to update(). */
+
+	int drawCalls() const { return imageDraws + primitiveDraws + textDraws; }
+
+	DrawCallStats& operator+=(const DrawCallStats& other)
+	{
+		frames += other.frames;
+		imageDraws += other.imageDraws;
+		primitiveDraws += other.primitiveDraws;
+		textDraws += other.textDraws;
+		textureSwitches += other.textureSwitches;
+		clipChanges += other.clipChanges;
+		cpuTime += other.cpuTime;
+		return *this;
+	}
+};
+
+
+inline std::ostream& operator<<(std::ostream& out, const DrawCallStats& stats)
+{
+	const auto frames = stats.frames > 0 ? stats.frames : 1;
+	const auto cpuMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(stats.cpuTime).count();
+
+	return out << "Frames: " << stats.frames << std::endl
+		<< "  Draw calls/frame:       " << stats.drawCalls() / frames << std::endl
+		<< "  Image draws/frame:      " << stats.imageDraws / frames << std::endl
+		<< "  Primitive draws/frame:  " << stats.primitiveDraws / frames << std::endl
+		<< "  Text draws/frame:       " << stats.textDraws / frames << std::endl
+		<< "  Texture switches/frame: " << stats.textureSwitches / frames << std::endl
+		<< "  Clip changes/frame:     " << stats.clipChanges / frames << std::endl
+		<< "  CPU time/frame:         " << cpuMicroseconds / frames << " us" << std::endl;
+}
+
+
+/**
+ * Renderer that counts draw calls before passing them on to another
+ * renderer implementation.
+ *
+ * The draw benchmark wraps NAS2D::RendererOpenGL. NAS2D::Image creates
+ * its texture when it's loaded, so the fonts, sprites and map images a map
+ * view loads need a GL context even when nothing is shown.
+ */
+template <typename BaseRenderer>
+class RecordingRenderer : public BaseRenderer
+{
+public:
+	template <typename... Args>
+	RecordingRenderer(Args&&... args) :
+		BaseRenderer(std::forward<Args>(args)...),
+		mFrameStart(std::chrono::steady_clock::now())
+	{}
+
+	const DrawCallStats& lastFrame() const { return mLastFrame; }
+	const DrawCallStats& total() const { return mTotal; }
+
+	void resetStats()
+	{
+		mCurrentFrame = {};
+		mLastFrame = {};
+		mTotal = {};
+		mLastTexture = nullptr;
+		mFrameStart = std::chrono::steady_clock::now();
+	}
+
+	void drawImage(const NAS2D::Image& image, NAS2D::Point<float> position, float scale = 1.0, NAS2D::Color color = NAS2D::Color::Normal) override
+	{
+		recordImage(image);
+		BaseRenderer::drawImage(image, position, scale, color);
+	}
+
+	void drawSubImage(const NAS2D::Image& image, NAS2D::Point<float> raster, const NAS2D::Rectangle<float>& subImageRect, NAS2D::Color color = NAS2D::Color::Normal) override
+	{
+		recordImage(image);
+		BaseRenderer::drawSubImage(image, raster, subImageRect, color);
+	}
+
+	void drawImageRotated(const NAS2D::Image& image, NAS2D::Point<float> position, float degrees, NAS2D::Color color = NAS2D::Color::Normal, float scale = 1.0f) override
+	{
+		recordImage(image);
+		BaseRenderer::drawImageRotated(image, position, degrees, color, scale);
+	}
+
+	void drawImageStretched(const NAS2D::Image& image, const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::Normal) override
+	{
+		recordImage(image);
+		BaseRenderer::drawImageStretched(image, rect, color);
+	}
+
+	void drawImageRepeated(const NAS2D::Image& image, const NAS2D::Rectangle<float>& rect) override
+	{
+		recordImage(image);
+		BaseRenderer::drawImageRepeated(image, rect);
+	}
+
+	void drawPoint(NAS2D::Point<float> position, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		++mCurrentFrame.primitiveDraws;
+		BaseRenderer::drawPoint(position, color);
+	}
+
+	void drawLine(NAS2D::Point<float> startPosition, NAS2D::Point<float> endPosition, NAS2D::Color color = NAS2D::Color::White, int lineWidth = 1) override
+	{
+		++mCurrentFrame.primitiveDraws;
+		BaseRenderer::drawLine(startPosition, endPosition, color, lineWidth);
+	}
+
+	void drawBox(const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		++mCurrentFrame.primitiveDraws;
+		BaseRenderer::drawBox(rect, color);
+	}
+
+	void drawBoxFilled(const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		++mCurrentFrame.primitiveDraws;
+		BaseRenderer::drawBoxFilled(rect, color);
+	}
+
+	void drawText(const NAS2D::Font& font, std::string_view text, NAS2D::Point<float> position, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		++mCurrentFrame.textDraws;
+		mLastTexture = nullptr; // Glyphs come from the font's own texture.
+		BaseRenderer::drawText(font, text, position, color);
+	}
+
+	void clipRect(const NAS2D::Rectangle<float>& rect) override
+	{
+		++mCurrentFrame.clipChanges;
+		BaseRenderer::clipRect(rect);
+	}
+
+	void update() override
+	{
+		const auto now = std::chrono::steady_clock::now();
+		mCurrentFrame.cpuTime = now - mFrameStart;
+		mCurrentFrame.frames = 1;
+
+		mLastFrame = mCurrentFrame;
+		mTotal += mCurrentFrame;
+		mCurrentFrame = {};
+		mLastTexture = nullptr;
+
+		BaseRenderer::update();
+		mFrameStart = std::chrono::steady_clock::now();
+	}
+
+private:
+	void recordImage(const NAS2D::Image& image)
+	{
+		++mCurrentFrame.imageDraws;
+		if (&image != mLastTexture)
+		{
+			++mCurrentFrame.textureSwitches;
+			mLastTexture = &image;
+		}
+	}
+
+	DrawCallStats mCurrentFrame;
+	DrawCallStats mLastFrame;
+	DrawCallStats mTotal;
+
+	const NAS2D::Image* mLastTexture = nullptr;
+	std::chrono::steady_clock::time_point mFrameStart;
+};
+
@@ -0,0 +1,175 @@
+#include "Benchmarks.h"
+#include "RecordingRenderer.h"
+
+#include "../OPHD/Cache.h"
+#include "../OPHD/Constants.h"
+
+#include <NAS2D/Utility.h>
+#include <NAS2D/Configuration.h>
+#include <NAS2D/Filesystem.h>
+#include <NAS2D/Mixer/MixerNull.h>
+#include <NAS2D/Renderer/RendererOpenGL.h>
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+using namespace NAS2D;
+
+
+namespace
+{
+	const int DefaultDrawFrames = 600;
+	const std::vector<std::size_t> DefaultLoadStructureCounts{1000, 10000, 100000};
+	const std::vector<int> DefaultTurnPopulations{100, 10000, 1000000};
+	const int TurnBenchmarkTurns = 20;
+	const std::size_t DefaultResourceCount = 10000;
+	const int DefaultResourcePasses = 200;
+
+
+	void printUsage(std::ostream& out)
+	{
+		out << "Usage:" << std::endl
+			<< "  ophd-benchmark draw [--frames count] savegame [savegame...]" << std::endl
+			<< "  ophd-benchmark load savegame [structures...]" << std::endl
+			<< "  ophd-benchmark turn savegame [populations...]" << std::endl
+			<< "  ophd-benchmark resources [count] [passes]" << std::endl;
+	}
+
+
+	std::string savegamePath(const std::string& name)
+	{
+		return constants::SaveGamePath + name + ".xml";
+	}
+
+
+	/**
+	 * Sets up what loading a game needs: the game's data and savegames, its
+	 * window settings, a silent mixer, a recording renderer and the UI atlas.
+	 */
+	void startUp(const char* executablePath)
+	{
+		auto& filesystem = Utility<Filesystem>::init<Filesystem>(executablePath, "OutpostHD", "LairWorks");
+		filesystem.mountSoftFail("data");
+		filesystem.mountSoftFail(filesystem.basePath() + "data");
+		filesystem.mountReadWrite(filesystem.prefPath());
+
+		auto& cf = Utility<Configuration>::init(
+			std::map<std::string, Dictionary>{
+				{
+					"graphics",
+					{{
+						{"screenwidth", constants::MinimumWindowSize.x},
+						{"screenheight", constants::MinimumWindowSize.y},
+						{"bitdepth", 32},
+						{"fullscreen", false},
+						{"vsync", false}
+					}}
+				}
+			}
+		);
+		cf.load("config.xml");
+
+		// Frames aren't held back to the display's refresh rate
+		auto& graphics = cf["graphics"];
+		graphics.set("fullscreen", false);
+		graphics.set("vsync", false);
+
+		decodedImageCache.preload(UiAtlasImages);
+
+		Utility<Mixer>::init<MixerNull>();
+		Utility<Renderer>::init<RecordingRenderer<RendererOpenGL>>("OutpostHD Benchmark");
+		uiAtlas.build(UiAtlasImages);
+		decodedImageCache.clear();
+	}
+
+
+	void shutDown()
+	{
+		spriteCache.clear();
+		decodedImageCache.clear();
+		uiAtlas.clear();
+		imageCache.clear();
+		SDL_Quit();
+	}
+}
+
+
+int main(int argc, char *argv[])
+{
+	const std::vector<std::string> arguments(argv + 1, argv + argc);
+	if (arguments.empty())
+	{
+		printUsage(std::cout);
+		return 1;
+	}
+
+	const auto& mode = arguments[0];
+
+	try
+	{
+		if (mode == "resources")
+		{
+			// Only needs the standard library so nothing else is set up
+			const auto count = arguments.size() > 1 ? static_cast<std::size_t>(std::stoul(arguments[1])) : DefaultResourceCount;
+			const int passes = arguments.size() > 2 ? std::stoi(arguments[2]) : DefaultResourcePasses;
+			storableResourcesBenchmark(std::cout, count, passes);
+			return 0;
+		}
+
+		if ((mode != "draw" && mode != "load" && mode != "turn") || arguments.size() < 2)
+		{
+			printUsage(std::cout);
+			return 1;
+		}
+
+		startUp(argv[0]);
+
+		if (mode == "draw")
+		{
+			int frames = DefaultDrawFrames;
+			std::vector<std::string> savegames;
+			for (std::size_t i = 1; i < arguments.size(); ++i)
+			{
+				if (arguments[i] == "--frames" && i + 1 < arguments.size()) { frames = std::stoi(arguments[++i]); }
+				else { savegames.push_back(savegamePath(arguments[i])); }
+			}
+
+			drawCallBenchmark(std::cout, savegames, frames);
+		}
+		else if (mode == "load")
+		{
+			std::vector<std::size_t> structureCounts;
+			for (std::size_t i = 2; i < arguments.size(); ++i)
+			{
+				structureCounts.push_back(static_cast<std::size_t>(std::stoul(arguments[i])));
+			}
+
+			loadBenchmark(std::cout, savegamePath(arguments[1]), structureCounts.empty() ? DefaultLoadStructureCounts : structureCounts);
+		}
+		else
+		{
+			std::vector<int> populations;
+			for (std::size_t i = 2; i < arguments.size(); ++i)
+			{
+				populations.push_back(std::stoi(arguments[i]));
+			}
+
+			turnBenchmark(std::cout, savegamePath(arguments[1]), populations.empty() ? DefaultTurnPopulations : populations, TurnBenchmarkTurns);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "Benchmark failed: " << e.what() << std::endl;
+		shutDown();
+		return 1;
+	}
+
+	shutDown();
+	return 0;
+}